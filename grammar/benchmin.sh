@@ -0,0 +1,57 @@
+#!/bin/bash
+#
+# Compare the scanner minimization algorithms on the grammars in this
+# directory. Each grammar is compiled to C with --minimize=partition and
+# --minimize=hopcroft and the best wall time of several runs is reported.
+#
+#   usage: benchmin.sh [colm-binary] [runs]
+#
+
+COLM=${1:-../colm/colm}
+RUNS=${2:-3}
+
+GRAMMARS="
+	rust/parserust.lm
+	c++/c++.lm
+	python/python.lm
+	go/parsego.lm
+	pcre/pcre.lm
+"
+
+cd "$(dirname "$0")"
+
+WORK=$(mktemp -d)
+trap 'rm -rf $WORK' EXIT
+
+TIMEFORMAT=%R
+
+# Best wall time of RUNS compiles. Leaves the generated C in $WORK/$2.c.
+best()
+{
+	local grammar=$1 alg=$2 best= t
+	for (( r = 0; r < RUNS; r++ )); do
+		t=$( { time "$COLM" -c -I "$(dirname $grammar)" --minimize=$alg \
+				-o $WORK/$alg.c $grammar >/dev/null 2>&1; } 2>&1 )
+		if [ -z "$best" ] || awk "BEGIN { exit !($t < $best) }"; then
+			best=$t
+		fi
+	done
+	echo $best
+}
+
+printf "%-24s %10s %10s %8s  %s\n" grammar partition hopcroft speedup tables
+for g in $GRAMMARS; do
+	p=$(best $g partition)
+	h=$(best $g hopcroft)
+
+	# Generated names embed pointers, mask them before comparing.
+	sed -i 's/0x[0-9a-f]*//g' $WORK/partition.c $WORK/hopcroft.c
+	if cmp -s $WORK/partition.c $WORK/hopcroft.c; then
+		tables=same
+	else
+		tables=differ
+	fi
+
+	printf "%-24s %10s %10s %7.2fx  %s\n" $g $p $h \
+			$(awk "BEGIN { print $p / ($h > 0 ? $h : 0.001) }") $tables
+done
@@ -134,7 +134,9 @@ static void make_stderr( program_t *prg )
 		prg->stderr_val = colm_stream_open_fd( prg, "<stderr>", 2 );
 }
 
-static void flush_streams( program_t *prg )
+/* Write out what is buffered for stdout and stderr. Runs when the program
+ * stops and before any exit from the middle of the program. */
+void colm_flush_streams( program_t *prg )
 {
 	if ( prg->stdout_val != 0 ) {
 		struct stream_impl *si = prg->stdout_val->impl;
@@ -155,49 +157,28 @@ void colm_parser_set_context( program_t *prg, tree_t **sp, parser_t *parser, str
 static head_t *tree_to_str_xml( program_t *prg, tree_t **sp, tree_t *tree, int trim, int attrs )
 {
 	/* Collect the tree data. */
-	str_collect_t collect;
-	init_str_collect( &collect );
+	str_collect_t *collect = colm_collect_borrow( prg );
+	colm_print_tree_collect_xml( prg, sp, collect, tree, trim );
 
-	colm_print_tree_collect_xml( prg, sp, &collect, tree, trim );
-
-	/* Set up the input stream. */
-	head_t *ret = string_alloc_full( prg, collect.data, collect.length );
-
-	str_collect_destroy( &collect );
-
-	return ret;
+	return colm_collect_to_string( prg, collect );
 }
 
 static head_t *tree_to_str_xml_ac( program_t *prg, tree_t **sp, tree_t *tree, int trim, int attrs )
 {
 	/* Collect the tree data. */
-	str_collect_t collect;
-	init_str_collect( &collect );
-
-	colm_print_tree_collect_xml_ac( prg, sp, &collect, tree, trim );
+	str_collect_t *collect = colm_collect_borrow( prg );
+	colm_print_tree_collect_xml_ac( prg, sp, collect, tree, trim );
 
-	/* Set up the input stream. */
-	head_t *ret = string_alloc_full( prg, collect.data, collect.length );
-
-	str_collect_destroy( &collect );
-
-	return ret;
+	return colm_collect_to_string( prg, collect );
 }
 
 static head_t *tree_to_str_postfix( program_t *prg, tree_t **sp, tree_t *tree, int trim, int attrs )
 {
 	/* Collect the tree data. */
-	str_collect_t collect;
-	init_str_collect( &collect );
-
-	colm_postfix_tree_collect( prg, sp, &collect, tree, trim );
-
-	/* Set up the input stream. */
-	head_t *ret = string_alloc_full( prg, collect.data, collect.length );
+	str_collect_t *collect = colm_collect_borrow( prg );
+	colm_postfix_tree_collect( prg, sp, collect, tree, trim );
 
-	str_collect_destroy( &collect );
-
-	return ret;
+	return colm_collect_to_string( prg, collect );
 }
 
 static word_t stream_append_text( program_t *prg, tree_t **sp, input_t *dest, tree_t *input, int trim )
@@ -210,14 +191,13 @@ static word_t stream_append_text( program_t *prg, tree_t **sp, input_t *dest, tr
 	}
 	else {
 		/* Collect the tree data. */
-		str_collect_t collect;
-		init_str_collect( &collect );
-		colm_print_tree_collect( prg, sp, &collect, input, trim );
+		str_collect_t *collect = colm_collect_borrow( prg );
+		colm_print_tree_collect( prg, sp, collect, input, trim );
 
 		/* Load it into the input. */
-		impl->funcs->append_data( prg, impl, colm_alph_from_cstr( collect.data ), collect.length );
-		length = collect.length;
-		str_collect_destroy( &collect );
+		impl->funcs->append_data( prg, impl, colm_alph_from_cstr( collect->data ), collect->length );
+		length = collect->length;
+		colm_collect_return( prg, collect );
 	}
 
 	return length;
@@ -233,14 +213,13 @@ static word_t stream_append_tree( program_t *prg, tree_t **sp, input_t *dest, tr
 	}
 	else if ( to_append->id == LEL_ID_STR ) {
 		/* Collect the tree data. */
-		str_collect_t collect;
-		init_str_collect( &collect );
-		colm_print_tree_collect( prg, sp, &collect, to_append, false );
+		str_collect_t *collect = colm_collect_borrow( prg );
+		colm_print_tree_collect( prg, sp, collect, to_append, false );
 
 		/* Load it into the to_append. */
-		impl->funcs->append_data( prg, impl, colm_alph_from_cstr( collect.data ), collect.length );
-		length = collect.length;
-		str_collect_destroy( &collect );
+		impl->funcs->append_data( prg, impl, colm_alph_from_cstr( collect->data ), collect->length );
+		length = collect->length;
+		colm_collect_return( prg, collect );
 	}
 	else {
 		colm_tree_upref( prg, to_append );
@@ -326,13 +305,12 @@ static long input_push( program_t *prg, tree_t **sp, struct input_impl *in, tree
 		assert( !ignore );
 			
 		/* Collect the tree data. */
-		str_collect_t collect;
-		init_str_collect( &collect );
-		colm_print_tree_collect( prg, sp, &collect, tree, false );
+		str_collect_t *collect = colm_collect_borrow( prg );
+		colm_print_tree_collect( prg, sp, collect, tree, false );
 
-		input_push_text( prg, in, tree->tokdata->location, collect.data, collect.length );
-		length = collect.length;
-		str_collect_destroy( &collect );
+		input_push_text( prg, in, tree->tokdata->location, collect->data, collect->length );
+		length = collect->length;
+		colm_collect_return( prg, collect );
 	}
 	else {
 		colm_tree_upref( prg, tree );
@@ -1591,12 +1569,15 @@ again:
 			break;
 		}
 		case IN_GET_RHS_VAL_WC:
+			colm_flush_streams( prg );
 			fatal( "UNIMPLEMENTED INSRUCTION: IN_GET_RHS_VAL_WC\n" );
 			break;
 		case IN_GET_RHS_VAL_WV:
+			colm_flush_streams( prg );
 			fatal( "UNIMPLEMENTED INSRUCTION: IN_GET_RHS_VAL_WV\n" );
 			break;
 		case IN_GET_RHS_VAL_BKT:
+			colm_flush_streams( prg );
 			fatal( "UNIMPLEMENTED INSRUCTION: IN_GET_RHS_VAL_BKT\n" );
 			break;
 
@@ -1626,9 +1607,11 @@ again:
 			//vm_push_tree( val );
 			break;
 		case IN_SET_RHS_VAL_WV:
+			colm_flush_streams( prg );
 			fatal( "UNIMPLEMENTED INSRUCTION: IN_SET_RHS_VAL_WV\n" );
 			break;
 		case IN_SET_RHS_VAL_BKT:
+			colm_flush_streams( prg );
 			fatal( "UNIMPLEMENTED INSRUCTION: IN_SET_RHS_VAL_BKT\n" );
 			break;
 		case IN_POP_TREE: {
@@ -1830,8 +1813,8 @@ again:
 
 			tree_t *o2 = vm_pop_tree();
 			tree_t *o1 = vm_pop_tree();
-			long r = colm_cmp_tree( prg, o1, o2 );
-			value_t val = r == 0 ? TRUE_VAL : FALSE_VAL;
+			int r = colm_equal_tree( prg, o1, o2 );
+			value_t val = r ? TRUE_VAL : FALSE_VAL;
 			vm_push_value( val );
 			colm_tree_downref( prg, sp, o1 );
 			colm_tree_downref( prg, sp, o2 );
@@ -1851,8 +1834,8 @@ again:
 
 			tree_t *o2 = vm_pop_tree();
 			tree_t *o1 = vm_pop_tree();
-			long r = colm_cmp_tree( prg, o1, o2 );
-			value_t val = r != 0 ? TRUE_VAL : FALSE_VAL;
+			int r = colm_equal_tree( prg, o1, o2 );
+			value_t val = !r ? TRUE_VAL : FALSE_VAL;
 			vm_push_value( val );
 			colm_tree_downref( prg, sp, o1 );
 			colm_tree_downref( prg, sp, o2 );
@@ -2422,7 +2405,7 @@ again:
 			else if ( trim == TRIM_NO )
 				auto_trim = false;
 			else 
-				auto_trim = si->funcs->get_option( prg, si, 0 );
+				auto_trim = si->funcs->get_option( prg, si, STREAM_OPT_AUTO_TRIM );
 
 			si->funcs->print_tree( prg, sp, si, to_send, auto_trim );
 			vm_push_stream( stream );
@@ -2447,7 +2430,7 @@ again:
 			else if ( trim == TRIM_NO )
 				auto_trim = false;
 			else 
-				auto_trim = si->funcs->get_option( prg, si, 0 );
+				auto_trim = si->funcs->get_option( prg, si, STREAM_OPT_AUTO_TRIM );
 
 			word_t len = stream_append_text( prg, sp, parser->input, to_send, auto_trim );
 
@@ -2503,7 +2486,7 @@ again:
 			else if ( trim == TRIM_NO )
 				auto_trim = false;
 			else 
-				auto_trim = si->funcs->get_option( prg, si, 0 );
+				auto_trim = si->funcs->get_option( prg, si, STREAM_OPT_AUTO_TRIM );
 
 			if ( auto_trim )
 				to_send = tree_trim( prg, sp, to_send );
@@ -2625,6 +2608,27 @@ again:
 			break;
 		}
 
+		case IN_SEND_REPARSE: {
+			debug( prg, REALM_BYTECODE, "IN_SEND_REPARSE\n" );
+
+			parser_t *parser = vm_pop_parser();
+			str_t *inserted = vm_pop_string();
+			value_t deleted = vm_pop_value();
+			value_t offset = vm_pop_value();
+			tree_t *old = vm_pop_tree();
+
+			struct input_impl *si = input_to_impl( parser->input );
+			long rescan = colm_reparse_append( prg, sp, si, old,
+					(long)offset, (long)deleted,
+					string_data( inserted->value ), string_length( inserted->value ) );
+
+			vm_push_value( (value_t)rescan );
+
+			colm_tree_downref( prg, sp, old );
+			colm_tree_downref( prg, sp, (tree_t*)inserted );
+			break;
+		}
+
 		case IN_INPUT_CLOSE_WC: {
 			debug( prg, REALM_BYTECODE, "IN_INPUT_CLOSE_WC\n" );
 
@@ -2643,7 +2647,19 @@ again:
 			value_t auto_trim = vm_pop_value();
 			struct stream_impl *si = stream->impl;
 
-			si->funcs->set_option( prg, si, 0, (long) auto_trim );
+			si->funcs->set_option( prg, si, STREAM_OPT_AUTO_TRIM, (long) auto_trim );
+
+			vm_push_stream( stream );
+			break;
+		}
+		case IN_INPUT_OUT_BUF_WC: {
+			debug( prg, REALM_BYTECODE, "IN_INPUT_OUT_BUF_WC\n" );
+
+			stream_t *stream = vm_pop_stream();
+			value_t size = vm_pop_value();
+			struct stream_impl *si = stream->impl;
+
+			si->funcs->set_option( prg, si, STREAM_OPT_OUT_BUF, (long) size );
 
 			vm_push_stream( stream );
 			break;
@@ -2655,7 +2671,7 @@ again:
 			value_t auto_trim = vm_pop_value();
 			struct input_impl *ii = input->impl;
 
-			ii->funcs->set_option( prg, ii, 0, (long) auto_trim );
+			ii->funcs->set_option( prg, ii, STREAM_OPT_AUTO_TRIM, (long) auto_trim );
 
 			vm_push_input( input );
 			break;
@@ -3182,6 +3198,7 @@ again:
 			head_t *head = string_copy( prg, ((str_t*)val)->value );
 			string_free( prg, tree->tokdata );
 			tree->tokdata = head;
+			tree->hash = 0;
 
 			colm_tree_downref( prg, sp, tree );
 			colm_tree_downref( prg, sp, val );
@@ -3196,6 +3213,7 @@ again:
 			head_t *oldval = tree->tokdata;
 			head_t *head = string_copy( prg, ((str_t*)val)->value );
 			tree->tokdata = head;
+			tree->hash = 0;
 
 			/* Set up reverse code. Needs no args. */
 			rcode_code( exec, IN_SET_TOKEN_DATA_BKT );
@@ -3216,6 +3234,7 @@ again:
 			head_t *head = (head_t*)oldval;
 			string_free( prg, tree->tokdata );
 			tree->tokdata = head;
+			tree->hash = 0;
 			colm_tree_downref( prg, sp, tree );
 			break;
 		}
@@ -4044,7 +4063,7 @@ again:
 			case FN_STOP: {
 				debug( prg, REALM_BYTECODE, "FN_STOP\n" );
 
-				flush_streams( prg );
+				colm_flush_streams( prg );
 				goto out;
 			}
 
@@ -4647,6 +4666,7 @@ again:
 				vm_pop_tree();
 				prg->exit_status = vm_pop_type(long);
 				prg->induce_exit = 1;
+				colm_flush_streams( prg );
 				exit( prg->exit_status );
 			}
 			case FN_EXIT: {
@@ -4703,6 +4723,7 @@ again:
 				goto out;
 			}
 			default: {
+				colm_flush_streams( prg );
 				fatal( "UNKNOWN FUNCTION: 0x%02x -- something is wrong\n", c );
 				break;
 			}}
@@ -4714,11 +4735,13 @@ again:
 		 * and can represent "not implemented" or "compiler error" because a
 		 * variable holding instructions was not properly initialize. */
 		case IN_HALT: {
+			colm_flush_streams( prg );
 			fatal( "IN_HALT -- compiler did something wrong\n" );
 			exit(1);
 			break;
 		}
 		default: {
+			colm_flush_streams( prg );
 			fatal( "UNKNOWN INSTRUCTION: 0x%02x -- something is wrong\n", *(instr-1) );
 			assert(false);
 			break;
@@ -5016,12 +5039,14 @@ again:
 			}
 
 			default: {
+				colm_flush_streams( prg );
 				fatal( "UNKNOWN FUNCTION 0x%02x: -- reverse code downref\n", *(instr-1));
 				assert(false);
 			}}
 			break;
 		}
 		default: {
+			colm_flush_streams( prg );
 			fatal( "UNKNOWN INSTRUCTION 0x%02x: -- reverse code downref\n", *(instr-1));
 			assert(false);
 			break;
@@ -254,6 +254,7 @@ typedef unsigned char uchar;
 #define IN_INPUT_CLOSE_WC        0xef
 #define IN_INPUT_AUTO_TRIM_WC    0x82
 #define IN_IINPUT_AUTO_TRIM_WC   0x83
+#define IN_INPUT_OUT_BUF_WC      0x86
 
 #define IN_PARSE_FRAG_W          0xa2
 #define IN_PARSE_INIT_BKT        0xa1
@@ -274,6 +275,8 @@ typedef unsigned char uchar;
 #define IN_SEND_EOF_W       0x87
 #define IN_SEND_EOF_BKT     0xa4
 
+#define IN_SEND_REPARSE     0x85
+
 #define IN_REDUCE_COMMIT         0xa5
 
 #define IN_PCR_RET               0xb2
@@ -469,6 +472,14 @@ enum LEL_ID {
 #define AF_LEFT_IGNORE   0x0100
 #define AF_RIGHT_IGNORE  0x0200
 
+/* The kids following the ignore headers (attributes, then children) were
+ * allocated as one contiguous run and are indexed directly. */
+#define AF_KID_RUN       0x1000
+
+/* Held in the hash-consing table, which shares it between all identical
+ * constructed trees. */
+#define AF_CONSED        0x2000
+
 #define AF_SUPPRESS_LEFT  0x4000
 #define AF_SUPPRESS_RIGHT 0x8000
 
@@ -648,6 +659,7 @@ head_t *make_literal( struct colm_program *prg, long litoffset );
 head_t *int_to_str( struct colm_program *prg, word_t i );
 
 void colm_execute( struct colm_program *prg, execution_t *exec, code_t *code );
+void colm_flush_streams( struct colm_program *prg );
 void reduction_execution( execution_t *exec, tree_t **sp );
 void generation_execution( execution_t *exec, tree_t **sp );
 void reverse_execution( execution_t *exec, tree_t **sp, struct rt_code_vect *all_rev );
@@ -59,6 +59,9 @@ struct colm_tree
 
 	/* FIXME: this needs to go somewhere else. Will do for now. */
 	unsigned short prod_num;
+
+	/* Cached structural hash, zero when not computed. */
+	unsigned int hash;
 };
 
 struct colm_print_args
@@ -123,7 +126,9 @@ static inline const char *colm_cstr_from_alph( const colm_alph_t *alph ) { retur
  */
 
 /* Allocate a program. Takes program static data as arg. Normally this is
- * &colm_object. */
+ * &colm_object. The static data is never modified, so any number of programs
+ * created from it can run concurrently, each on its own thread. A program and
+ * the trees it produces must only be used by one thread at a time. */
 struct colm_program *colm_new_program( struct colm_sections *rtd );
 
 /* Enable debug realms for a program. */
@@ -139,6 +144,10 @@ void colm_run_program2( struct colm_program *prg, int argc, const char **argv, c
 struct colm_tree *colm_run_func( struct colm_program *prg, int frame_id,
 		const char **params, int param_count );
 
+/* Release everything a program holds and return it to its freshly created
+ * state so it can be run again. Allocations are kept for reuse. */
+void colm_reset_program( struct colm_program *prg );
+
 /* Delete a colm program. Clears all memory. */
 int colm_delete_program( struct colm_program *prg );
 
@@ -147,8 +156,61 @@ void *colm_get_reduce_ctx( struct colm_program *prg );
 void colm_set_reduce_ctx( struct colm_program *prg, void *ctx );
 void colm_set_reduce_clean( struct colm_program *prg, unsigned char reduce_clean );
 
+/* Commit parsers at each completed nonterminal once no retry can reach it. With
+ * a reducer the element is reduced and released immediately, otherwise only
+ * the parse trees beneath it are released. Committed input cannot be undone. */
+void colm_set_auto_commit( struct colm_program *prg, unsigned char auto_commit );
+
+/* Share structurally identical trees made by constructors. Tokens and small
+ * nonterminals built entirely from constructor text (no bindings, ignores or
+ * attributes) are looked up in a table and an existing identical tree is
+ * returned instead. Such trees are copied on write like any shared tree. */
+void colm_set_hash_cons( struct colm_program *prg, unsigned char hash_cons );
+
+/* Use cached structural hashes to reject unequal trees in == and != without
+ * walking them. The hash is computed on the first test that needs it. */
+void colm_set_tree_hash( struct colm_program *prg, unsigned char tree_hash );
+
+/* Structural hash of a tree, consistent with tree comparison: equal trees
+ * hash the same. Attributes, ignores and production numbers don't count. */
+unsigned int colm_tree_hash( struct colm_program *prg, struct colm_tree *tree );
+
 const char *colm_error( struct colm_program *prg, int *length );
 
+/* Work done by copy-on-write splits. Modifying a shared tree copies only the
+ * shared nodes on the path down to the modification, one level at a time:
+ * the node, its kid list and its token text. Children stay shared. */
+struct colm_split_stats
+{
+	long splits;
+	long trees;
+	long kids;
+	long bytes;
+};
+
+void colm_split_stats( struct colm_program *prg, struct colm_split_stats *stats );
+
+/* Parallel parsing of input split at a top-level delimiter. Each worker thread
+ * owns a program created from the shared sections. */
+typedef void (*colm_chunk_fn)( struct colm_program *prg, long chunk,
+		const char *data, long length, void *arg );
+long colm_split_chunks( const char *data, long length,
+		const char *delim, long delim_len, long max_chunks, long *ends );
+int colm_parse_chunks( struct colm_sections *rtd, int threads,
+		const char *data, long nchunks, const long *ends,
+		colm_chunk_fn fn, void *arg );
+
+/* Binary tree snapshots. A snapshot records ids, production numbers, token
+ * data, locations and ignores, and loads without scanning or parsing into a
+ * program built from the same grammar. Loading returns the tree with one
+ * reference held by the caller, or zero if the snapshot is refused. Trees
+ * loaded from a file keep their token data in the file's mapping, which stays
+ * until the program is reset or deleted. */
+long colm_tree_serialize( struct colm_program *prg, struct colm_tree *tree, char **data );
+struct colm_tree *colm_tree_deserialize( struct colm_program *prg, const char *data, long length );
+int colm_tree_save( struct colm_program *prg, struct colm_tree *tree, const char *fn );
+struct colm_tree *colm_tree_load( struct colm_program *prg, const char *fn );
+
 const char **colm_extract_fns( struct colm_program *prg );
 
 #ifdef __cplusplus
@@ -45,6 +45,31 @@ void commit_clear_kid_list( program_t *prg, tree_t **sp, kid_t *kid )
 	}
 }
 
+/* Release the kids of a tree, leaving it with none. */
+void commit_clear_tree_kids( program_t *prg, tree_t **sp, tree_t *tree )
+{
+	if ( tree->flags & AF_KID_RUN ) {
+		kid_t *kid = tree->child, *run = get_attr_kid( tree, 0 ), *next;
+		while ( kid != run ) {
+			colm_tree_downref( prg, sp, kid->tree );
+			next = kid->next;
+			kid_free( prg, kid );
+			kid = next;
+		}
+
+		long length = 0;
+		for ( ; kid != 0; kid = kid->next, length++ )
+			colm_tree_downref( prg, sp, kid->tree );
+		kid_free_run( prg, run, length );
+	}
+	else {
+		commit_clear_kid_list( prg, sp, tree->child );
+	}
+
+	tree->child = 0;
+	tree->flags &= ~( AF_LEFT_IGNORE | AF_RIGHT_IGNORE | AF_KID_RUN );
+}
+
 void commit_clear_parse_tree( program_t *prg, tree_t **sp,
 		struct pda_run *pda_run, parse_tree_t *pt )
 {
@@ -109,3 +134,19 @@ void commit_reduce( program_t *prg, tree_t **root, struct pda_run *pda_run )
 		pt = pt->next;
 	}
 }
+
+/* Commit without a reducer. The data trees make up the parse result and are
+ * kept, only the parse trees beneath the uncommitted stack elements are
+ * released. */
+void commit_release( program_t *prg, tree_t **root, struct pda_run *pda_run )
+{
+	parse_tree_t *pt = pda_run->stack_top;
+
+	while ( pt != 0 && !been_committed( pt ) ) {
+		commit_clear_parse_tree( prg, root, pda_run, pt->child );
+		pt->child = 0;
+
+		pt->flags |= PF_COMMITTED;
+		pt = pt->next;
+	}
+}
@@ -28,7 +28,11 @@
 #include <stdbool.h>
 #include <unistd.h>
 #include <assert.h>
+#include <pthread.h>
+#include <time.h>
+#include <sys/resource.h>
 #include <iostream>
+#include <fstream>
 
 #include "redbuild.h"
 #include "pdacodegen.h"
@@ -59,7 +63,7 @@ void afterOpMinimize( FsmGraph *fsm, bool lastInSeq )
 		 * intersection operators are the only places where they may be
 		 * created and those operators clean them up. */
 		fsm->removeUnreachableStates();
-		fsm->minimizePartition2();
+		fsm->minimize();
 	}
 }
 
@@ -219,7 +223,7 @@ FsmGraph *makeBuiltin( BuiltinMachine builtin, Compiler *pd )
 		upper->rangeFsm( 'A', 'Z' );
 		lower->rangeFsm( 'a', 'z' );
 		upper->unionOp( lower );
-		upper->minimizePartition2();
+		upper->minimize();
 		retFsm = upper;
 		break;
 	}
@@ -238,7 +242,7 @@ FsmGraph *makeBuiltin( BuiltinMachine builtin, Compiler *pd )
 		lower->rangeFsm( 'a', 'z' );
 		digit->unionOp( upper );
 		digit->unionOp( lower );
-		digit->minimizePartition2();
+		digit->minimize();
 		retFsm = digit;
 		break;
 	}
@@ -261,7 +265,7 @@ FsmGraph *makeBuiltin( BuiltinMachine builtin, Compiler *pd )
 		cntrl->rangeFsm( 0, 31 );
 		highChar->concatFsm( 127 );
 		cntrl->unionOp( highChar );
-		cntrl->minimizePartition2();
+		cntrl->minimize();
 		retFsm = cntrl;
 		break;
 	}
@@ -290,7 +294,7 @@ FsmGraph *makeBuiltin( BuiltinMachine builtin, Compiler *pd )
 		range1->unionOp( range2 );
 		range1->unionOp( range3 );
 		range1->unionOp( range4 );
-		range1->minimizePartition2();
+		range1->minimize();
 		retFsm = range1;
 		break;
 	}
@@ -301,7 +305,7 @@ FsmGraph *makeBuiltin( BuiltinMachine builtin, Compiler *pd )
 		cntrl->rangeFsm( '\t', '\r' );
 		space->concatFsm( ' ' );
 		cntrl->unionOp( space );
-		cntrl->minimizePartition2();
+		cntrl->minimize();
 		retFsm = cntrl;
 		break;
 	}
@@ -315,7 +319,7 @@ FsmGraph *makeBuiltin( BuiltinMachine builtin, Compiler *pd )
 		lower->rangeFsm( 'a', 'f' );
 		digit->unionOp( upper );
 		digit->unionOp( lower );
-		digit->minimizePartition2();
+		digit->minimize();
 		retFsm = digit;
 		break;
 	}
@@ -370,6 +374,8 @@ Compiler::Compiler( )
 
 	firstNonTermId(0),
 	prodIdIndex(0),
+	followFirst(0),
+	followFirstEpsilon(0),
 
 	global(0),
 	globalSel(0),
@@ -397,6 +403,7 @@ Compiler::Compiler( )
 	nextObjectId(1),     /* 0 is  reserved for no object. */
 	nextFrameId(0),
 	nextParserId(0),
+	numRuntimeParsers(0),
 	revertOn(true),
 	predValue(0),
 	nextMatchEndNum(0),
@@ -609,7 +616,7 @@ void Compiler::finishGraphBuild( FsmGraph *graph )
 
 	/* Minimize here even if we minimized at every op. Now that function
 	 * keys have been cleared we may get a more minimal fsm. */
-	graph->minimizePartition2();
+	graph->minimize();
 	graph->compressTransitions();
 }
 
@@ -628,27 +635,235 @@ NameInst *Compiler::makeNameTree()
 	return 0;
 }
 
+double compileTime()
+{
+	struct timespec ts;
+	clock_gettime( CLOCK_MONOTONIC, &ts );
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* Number of threads to use for a compile step with the given amount of
+ * independent work. */
+int compileThreads( long work )
+{
+	long threads = gblThreads;
+	if ( threads <= 0 )
+		threads = sysconf( _SC_NPROCESSORS_ONLN );
+	if ( threads > work )
+		threads = work;
+	return threads < 1 ? 1 : threads;
+}
+
+struct CompilePhase
+{
+	const char *name;
+	double time;
+	long rss;
+	long count;
+	const char *countName;
+	bool summed;
+};
+
+static Vector<CompilePhase> compilePhases;
+static pthread_mutex_t phaseMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static double profileStart = -1;
+static double phaseStart;
+static long phaseRss;
+static const char *phaseName;
+static bool phaseChildren;
+
+/* Peak resident set, in kB, of this process or of its waited-for children. */
+static long peakRss( bool children )
+{
+	struct rusage usage;
+	getrusage( children ? RUSAGE_CHILDREN : RUSAGE_SELF, &usage );
+	return usage.ru_maxrss;
+}
+
+void phaseBegin( const char *name, bool children )
+{
+	phaseName = name;
+	phaseChildren = children;
+	phaseRss = peakRss( children );
+	phaseStart = compileTime();
+	if ( profileStart < 0 )
+		profileStart = phaseStart;
+}
+
+void phaseEnd( long count, const char *countName )
+{
+	CompilePhase phase;
+	phase.name = phaseName;
+	phase.time = compileTime() - phaseStart;
+	phase.rss = peakRss( phaseChildren ) - phaseRss;
+	phase.count = count;
+	phase.countName = countName;
+	phase.summed = false;
+
+	pthread_mutex_lock( &phaseMutex );
+	compilePhases.append( phase );
+	pthread_mutex_unlock( &phaseMutex );
+}
+
+void phaseSum( const char *name, double time, const char *countName )
+{
+	pthread_mutex_lock( &phaseMutex );
+
+	CompilePhase *phase = 0;
+	for ( Vector<CompilePhase>::Iter p = compilePhases; p.lte(); p++ ) {
+		if ( p->summed && strcmp( p->name, name ) == 0 )
+			phase = p;
+	}
+
+	if ( phase == 0 ) {
+		CompilePhase init = { name, 0, 0, 0, countName, true };
+		compilePhases.append( init );
+		phase = &compilePhases[compilePhases.length()-1];
+	}
+
+	phase->time += time;
+	phase->count += 1;
+
+	pthread_mutex_unlock( &phaseMutex );
+}
+
+static void writeProfileJson( std::ostream &out, double total )
+{
+	out << "{\n  \"phases\": [\n";
+	for ( Vector<CompilePhase>::Iter p = compilePhases; p.lte(); p++ ) {
+		out << "    { \"name\": \"" << p->name << "\", \"ms\": " <<
+				p->time * 1000.0 << ", \"rss_kb\": " << p->rss <<
+				", \"count\": " << p->count << ", \"count_name\": \"" <<
+				p->countName << "\", \"summed\": " <<
+				( p->summed ? "true" : "false" ) << " }" <<
+				( p.last() ? "" : "," ) << "\n";
+	}
+	out << "  ],\n  \"total_ms\": " << total * 1000.0 <<
+			",\n  \"peak_rss_kb\": " << peakRss( false ) << "\n}\n";
+}
+
+void reportProfile()
+{
+	if ( profileStart < 0 )
+		return;
+
+	double total = compileTime() - profileStart;
+
+	if ( printStatistics ) {
+		for ( Vector<CompilePhase>::Iter p = compilePhases; p.lte(); p++ ) {
+			cerr << "phase " << p->name << ": " << p->time * 1000.0 << " ms" <<
+					( p->summed ? " (summed)" : "" ) << ", rss +" << p->rss <<
+					" kB, " << p->count << " " << p->countName << endl;
+		}
+		cerr << "total: " << total * 1000.0 << " ms, peak rss " <<
+				peakRss( false ) << " kB" << endl;
+	}
+
+	if ( profileFn != 0 ) {
+		std::ofstream out( profileFn );
+		if ( !out.is_open() )
+			error() << "error opening " << profileFn << " for writing" << endl;
+		else
+			writeProfileJson( out, total );
+	}
+
+	/* Only report once, even when called again on the way out. */
+	profileStart = -1;
+}
+
+/* Regions handed out to the threads joining scanner graphs. */
+struct RegionPool
+{
+	Compiler *pd;
+	RegionImpl **regions;
+	FsmGraph **graphs;
+	double *times;
+	long numRegions;
+
+	pthread_mutex_t mutex;
+	long next;
+};
+
+static void *joinRegions( void *arg )
+{
+	RegionPool *pool = (RegionPool*) arg;
+	while ( true ) {
+		pthread_mutex_lock( &pool->mutex );
+		long r = pool->next++;
+		pthread_mutex_unlock( &pool->mutex );
+
+		if ( r >= pool->numRegions )
+			break;
+
+		double start = compileTime();
+		FsmGraph *graph = pool->regions[r]->joinTokens( pool->pd );
+		pool->pd->finishGraphBuild( graph );
+		pool->graphs[r] = graph;
+		pool->times[r] += compileTime() - start;
+	}
+	return 0;
+}
+
 FsmGraph *Compiler::makeAllRegions()
 {
 	/* Build the name tree and supporting data structures. */
 	makeNameTree();
 	NameInst **nameIndex = makeNameIndex();
 
-	int numGraphs = 0;
-	FsmGraph **graphs = new FsmGraph*[regionImplList.length()];
+	int numGraphs = regionImplList.length();
+	FsmGraph **graphs = new FsmGraph*[numGraphs];
+	RegionImpl **regions = new RegionImpl*[numGraphs];
+	double *times = new double[numGraphs];
+
+	/* Walking the token patterns draws on shared compiler state, so that
+	 * part is done in order. */
+	int r = 0;
+	for ( RegionImplList::Iter rel = regionImplList; rel.lte(); rel++, r++ ) {
+		double start = compileTime();
+		rel->walkTokens( this );
+		regions[r] = rel;
+		times[r] = compileTime() - start;
+	}
 
-	/* Make all the instantiations, we know that main exists in this list. */
-	for ( RegionImplList::Iter rel = regionImplList; rel.lte(); rel++ ) {
-		/* Build the graph from a walk of the parse tree. */
-		FsmGraph *newGraph = rel->walk( this );
+	/* Union, minimize and finish each region's graph. These only touch the
+	 * region's own graphs and can run concurrently. */
+	RegionPool pool;
+	pool.pd = this;
+	pool.regions = regions;
+	pool.graphs = graphs;
+	pool.times = times;
+	pool.numRegions = numGraphs;
+	pool.next = 0;
+	pthread_mutex_init( &pool.mutex, 0 );
+
+	int numThreads = compileThreads( numGraphs );
+	if ( numThreads <= 1 )
+		joinRegions( &pool );
+	else {
+		pthread_t *threads = new pthread_t[numThreads];
+		for ( int t = 0; t < numThreads; t++ )
+			pthread_create( &threads[t], 0, joinRegions, &pool );
+		for ( int t = 0; t < numThreads; t++ )
+			pthread_join( threads[t], 0 );
+		delete[] threads;
+	}
 
-		/* Wrap up the construction. */
-		finishGraphBuild( newGraph );
+	pthread_mutex_destroy( &pool.mutex );
 
-		/* Save off the new graph. */
-		graphs[numGraphs++] = newGraph;
+	if ( printStatistics ) {
+		for ( r = 0; r < numGraphs; r++ ) {
+			cerr << "region " << regions[r]->regionNameInst->id <<
+					": " << regions[r]->tokenInstanceList.length() << " tokens, " <<
+					graphs[r]->stateList.length() << " states, " <<
+					times[r] * 1000.0 << " ms" << endl;
+		}
+		cerr << "region threads: " << numThreads << endl;
 	}
 
+	delete[] regions;
+	delete[] times;
+
 	/* NOTE: If putting in minimization here we need to include eofTarget
 	 * into the minimization algorithm. It is currently set by the longest
 	 * match operator and not considered anywhere else. */
@@ -662,8 +877,8 @@ FsmGraph *Compiler::makeAllRegions()
 		/* Add all the other graphs into the first. */
 		all = graphs[0];
 		all->globOp( graphs+1, numGraphs-1 );
-		delete[] graphs;
 	}
+	delete[] graphs;
 
 	/* Go through all the token regions and check for lmRequiresErrorState. */
 	for ( RegionImplList::Iter reg = regionImplList; reg.lte(); reg++ ) {
@@ -732,7 +947,9 @@ void Compiler::analyzeGraph( FsmGraph *graph )
 FsmGraph *Compiler::makeScanner()
 {
 	/* Make the graph, do minimization. */
+	phaseBegin( "regions" );
 	FsmGraph *fsmGraph = makeAllRegions();
+	phaseEnd( fsmGraph->stateList.length(), "states" );
 
 	/* If any errors have occured in the input file then don't write anything. */
 	if ( gblErrorCount > 0 )
@@ -976,7 +1193,7 @@ void Compiler::initEmptyScanner( RegionSet *regionSet, TokenRegion *reg )
 		reg->impl->wasEmpty = true;
 
 		static int def = 1;
-		String name( 64, "__%p_DEF_PAT_%d", reg, def++ );
+		String name( 64, "__%d_DEF_PAT_%d", reg->id, def++ );
 
 		LexJoin *join = LexJoin::cons( LexExpression::cons( BT_Any ) );
 
@@ -1009,7 +1226,7 @@ void Compiler::initEmptyScanners()
 	}
 }
 
-pda_run *Compiler::parsePattern( program_t *prg, tree_t **sp, const InputLoc &loc, 
+pda_run *Compiler::parsePattern( program_t *prg, tree_t **sp, 
 		int parserId, struct input_impl *sourceStream )
 {
 	struct pda_run *pdaRun = new pda_run;
@@ -1017,27 +1234,31 @@ pda_run *Compiler::parsePattern( program_t *prg, tree_t **sp, const InputLoc &lo
 
 	long pcr = colm_parse_loop( prg, sp, pdaRun, sourceStream, PCR_START );
 	assert( pcr == PCR_DONE );
-	if ( pdaRun->parse_error ) {
-		cerr << ( loc.fileName != 0 ? loc.fileName : "<input>" ) <<
-				":" << loc.line << ":" << loc.col;
-
-		if ( pdaRun->parse_error_text != 0 ) {
-			colm_data *tokdata = pdaRun->parse_error_text->tokdata;
-			cerr << ": relative error: ";
-			cerr.write( (const char*)tokdata->data, tokdata->length );
-		}
-		else {
-			cerr << ": parse error";
-		}
 
-		cerr << endl;
-		gblErrorCount += 1;
+	return pdaRun;
+}
+
+void Compiler::patternError( const InputLoc &loc, struct pda_run *pdaRun )
+{
+	cerr << ( loc.fileName != 0 ? loc.fileName : "<input>" ) <<
+			":" << loc.line << ":" << loc.col;
+
+	if ( pdaRun->parse_error_text != 0 ) {
+		colm_data *tokdata = pdaRun->parse_error_text->tokdata;
+		cerr << ": relative error: ";
+		cerr.write( (const char*)tokdata->data, tokdata->length );
+	}
+	else {
+		cerr << ": parse error";
 	}
 
-	return pdaRun;
+	cerr << endl;
+	gblErrorCount += 1;
 }
 
-void Compiler::parsePatterns()
+/* A program for parsing patterns. Trees in the resulting parse trees belong
+ * to it, so it is never deleted. */
+program_t *Compiler::patternProgram()
 {
 	program_t *prg = colm_new_program( runtimeData );
 
@@ -1046,29 +1267,146 @@ void Compiler::parsePatterns()
 	/* Turn off context-dependent parsing. */
 	prg->ctx_dep_parsing = 0;
 
-	tree_t **sp = prg->stack_root;
+	return prg;
+}
+
+#define PATTERNS_PER_THREAD 64
+
+/* A pattern or constructor to parse. */
+struct PatternJob
+{
+	const InputLoc *loc;
+	int parserId;
+	struct input_impl *in;
+	struct pda_run **pdaRun;
+};
+
+/* Patterns handed out to the threads parsing them. Each thread parses with
+ * its own program over the shared tables. */
+struct PatternPool
+{
+	Compiler *pd;
+	PatternJob *jobs;
+	long numJobs;
+
+	pthread_mutex_t mutex;
+	long next;
+
+	/* The first program a thread created. Filling in the pattern nodes
+	 * afterwards reads trees through it. */
+	program_t *first;
+};
+
+static void *parsePatternJobs( void *arg )
+{
+	PatternPool *pool = (PatternPool*) arg;
+	program_t *prg = 0;
+	while ( true ) {
+		pthread_mutex_lock( &pool->mutex );
+		long j = pool->next++;
+		pthread_mutex_unlock( &pool->mutex );
+
+		if ( j >= pool->numJobs )
+			break;
+
+		if ( prg == 0 ) {
+			prg = pool->pd->patternProgram();
+
+			pthread_mutex_lock( &pool->mutex );
+			if ( pool->first == 0 )
+				pool->first = prg;
+			pthread_mutex_unlock( &pool->mutex );
+		}
+
+		PatternJob *job = &pool->jobs[j];
+		*job->pdaRun = pool->pd->parsePattern( prg, prg->stack_root,
+				job->parserId, job->in );
+	}
+	return 0;
+}
+
+void Compiler::parsePatterns()
+{
+	double start = compileTime();
 
+	/* Jobs are laid out in list order so that errors are reported and
+	 * pattern nodes filled in deterministically. */
+	long numJobs = patternList.length();
+	for ( ConsList::Iter cons = replList; cons.lte(); cons++ ) {
+		if ( cons->langEl != 0 )
+			numJobs += 1;
+	}
+
+	PatternJob *jobs = new PatternJob[numJobs];
+	long j = 0;
 	for ( ConsList::Iter cons = replList; cons.lte(); cons++ ) {
 		if ( cons->langEl != 0 ) {
-			struct input_impl *in = colm_impl_new_cons( strdup("<internal>"), cons );
-			cons->pdaRun = parsePattern( prg, sp, cons->loc, cons->langEl->parserId, in );
+			jobs[j].loc = &cons->loc;
+			jobs[j].parserId = cons->langEl->parserId;
+			jobs[j].in = colm_impl_new_cons( strdup("<internal>"), cons );
+			jobs[j].pdaRun = &cons->pdaRun;
+			j += 1;
 		}
 	}
 
 	for ( PatList::Iter pat = patternList; pat.lte(); pat++ ) {
-		struct input_impl *in = colm_impl_new_pat( strdup("<internal>"), pat );
-		pat->pdaRun = parsePattern( prg, sp, pat->loc, pat->langEl->parserId, in );
+		jobs[j].loc = &pat->loc;
+		jobs[j].parserId = pat->langEl->parserId;
+		jobs[j].in = colm_impl_new_pat( strdup("<internal>"), pat );
+		jobs[j].pdaRun = &pat->pdaRun;
+		j += 1;
+	}
+
+	PatternPool pool;
+	pool.pd = this;
+	pool.jobs = jobs;
+	pool.numJobs = numJobs;
+	pool.next = 0;
+	pool.first = 0;
+	pthread_mutex_init( &pool.mutex, 0 );
+
+	/* Starting a thread costs about as much as parsing a few dozen patterns. */
+	int numThreads = compileThreads( numJobs / PATTERNS_PER_THREAD );
+	if ( numThreads <= 1 )
+		parsePatternJobs( &pool );
+	else {
+		pthread_t *threads = new pthread_t[numThreads];
+		for ( int t = 0; t < numThreads; t++ )
+			pthread_create( &threads[t], 0, parsePatternJobs, &pool );
+		for ( int t = 0; t < numThreads; t++ )
+			pthread_join( threads[t], 0 );
+		delete[] threads;
+	}
+
+	pthread_mutex_destroy( &pool.mutex );
+
+	for ( j = 0; j < numJobs; j++ ) {
+		if ( (*jobs[j].pdaRun)->parse_error )
+			patternError( *jobs[j].loc, *jobs[j].pdaRun );
+	}
+
+	delete[] jobs;
+
+	if ( printStatistics ) {
+		cerr << "patterns: " << numJobs << ", " <<
+				( compileTime() - start ) * 1000.0 << " ms" << endl;
+		cerr << "pattern threads: " << numThreads << endl;
 	}
 
 	/* Bail on above errors. */
 	if ( gblErrorCount > 0 )
 		exit(1);
 
-	fillInPatterns( prg );
+	/* With no patterns no program was made, but none is needed. */
+	fillInPatterns( pool.first );
 }
 
 void Compiler::collectParserEls( BstSet<LangEl*> &parserEls )
 {
+	/* Parsers declared so far are used by the program. The rest are made
+	 * here for patterns and constructors. */
+	numRuntimeParsers = nextParserId;
+
 	for ( PatList::Iter pat = patternList; pat.lte(); pat++ ) {
 		/* We assume the reduction action compilation phase was run before
 		 * pattern parsing and it decorated the pattern with the target type. */
@@ -1167,6 +1505,7 @@ void Compiler::generateOutput( long activeRealm, bool includeCommit )
 	pdaGen->writeParserData( 0, pdaTables );
 
 	/* Write the runtime data. */
+	pdaGen->writeCodeData( runtimeData );
 	pdaGen->writeRuntimeData( runtimeData, pdaTables );
 
 	writeHostCall();
@@ -1180,6 +1519,42 @@ void Compiler::generateOutput( long activeRealm, bool includeCommit )
 	outStream->flush();
 }
 
+/* Write one file of split output. Each is compiled on its own. */
+void Compiler::generateOutputPart( OutputPart part, long activeRealm, bool includeCommit )
+{
+	FsmCodeGen *fsmGen = new FsmCodeGen( *outStream, redFsm, fsmTables );
+
+	PdaCodeGen *pdaGen = new PdaCodeGen( *outStream );
+
+	fsmGen->writeIncludes();
+
+	switch ( part ) {
+		case OutputScanner:
+			fsmGen->writeCode();
+			break;
+		case OutputTables:
+			pdaGen->writeParserData( 0, pdaTables );
+			break;
+		case OutputBytecode:
+			pdaGen->writeCodeData( runtimeData );
+			break;
+		case OutputReducers:
+			writeHostCall();
+			if ( includeCommit )
+				writeCommitStub();
+			break;
+		case OutputRuntime:
+			pdaGen->defineRuntime();
+			pdaGen->declareShared();
+			pdaGen->writeRuntimeData( runtimeData, pdaTables );
+			if ( !gblLibrary ) 
+				fsmGen->writeMain( activeRealm );
+			break;
+	}
+
+	outStream->flush();
+}
+
 
 void Compiler::prepGrammar()
 {
@@ -1212,10 +1587,12 @@ void Compiler::compile()
 	initKeyOps();
 
 	/* Declare types. */
+	phaseBegin( "resolve" );
 	declarePass();
 
 	/* Resolve type references. */
 	resolvePass();
+	phaseEnd( langEls.length(), "lang els" );
 
 	makeTerminalWrappers();
 	makeEofElements();
@@ -1228,19 +1605,25 @@ void Compiler::compile()
 	initLongestMatchData();
 	FsmGraph *fsmGraph = makeScanner();
 
+	phaseBegin( "prepare" );
 	prepGrammar();
 
 	placeAllLanguageObjects();
 	placeAllStructObjects();
 	placeAllFrameObjects();
 	placeAllFunctions();
+	phaseEnd( nextLelId, "lang els" );
 
 	/* Compile bytecode. */
+	phaseBegin( "bytecode" );
 	compileByteCode();
+	phaseEnd( functionList.length(), "functions" );
 
 	/* Make the reduced scanner. */
+	phaseBegin( "reduce scanner" );
 	RedFsmBuild reduce( this, fsmGraph );
 	redFsm = reduce.reduceMachine();
+	phaseEnd( redFsm->stateList.length(), "states" );
 
 	BstSet<LangEl*> parserEls;
 	collectParserEls( parserEls );
@@ -1258,6 +1641,12 @@ void Compiler::compile()
 	 */
 	
 	/* Parse constructors and patterns. */
+	phaseBegin( "patterns" );
 	parsePatterns();
+	phaseEnd( patternList.length() + replList.length(), "patterns" );
+
+	phaseBegin( "prune" );
+	pruneOutput();
+	phaseEnd( pdaTables->num_states, "states" );
 }
 
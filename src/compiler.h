@@ -55,6 +55,12 @@ void operator<<( std::ostream &out, exit_object & );
 extern const char *objectName;
 extern bool hostAdapters;
 
+/* The compiler builds parse tables as int and unsigned int arrays. */
+inline pda_tab pdaTab( const int *data )
+	{ pda_tab tab = { data, PDA_TAB_S32 }; return tab; }
+inline pda_tab pdaTab( const unsigned int *data )
+	{ pda_tab tab = { data, PDA_TAB_U32 }; return tab; }
+
 /* Forwards. */
 struct RedFsm;
 struct LangEl;
@@ -121,6 +127,16 @@ typedef Vector< ProdEl* > FactorVect;
 typedef AvlMap<String, long, ColmCmpStr> StringMap;
 typedef AvlMapEl<String, long> StringMapEl;
 
+/* The files of split output. The runtime part holds the colm_sections
+ * definition and main. */
+enum OutputPart {
+	OutputScanner,
+	OutputTables,
+	OutputBytecode,
+	OutputReducers,
+	OutputRuntime
+};
+
 enum PredType { 
 	PredLeft,
 	PredRight,
@@ -729,13 +745,14 @@ struct Compiler
 	bool makeFirstSetProd( Production *prod, PdaState *state );
 	void makeFirstSets();
 
-	int findIndexOff( struct pda_tables *pdaTables, PdaGraph *pdaGraph,
-			PdaState *state, int &currLen );
+	int findIndexOff( unsigned long *taken, int *spans,
+			int numSpans, int &currLen );
 	void trySetTime( PdaTrans *trans, long code, long &time );
 	void addRegion( PdaState *tabState, PdaTrans *pdaTrans, long pdaKey,
 			bool noPreIgnore, bool noPostIgnore );
 	PdaState *followProd( PdaState *tabState, PdaState *prodState );
-	void findFollow( AlphSet &result, PdaState *overTab, 
+	void makeFollowFirstSets();
+	void findFollow( LelBitSet &result, PdaState *overTab, 
 			PdaState *overSrc, Production *parentDef );
 	void pdaActionOrder( PdaGraph *pdaGraph, LangElSet &parserEls );
 	void pdaOrderFollow( LangEl *rootEl, PdaState *tabState, 
@@ -773,16 +790,25 @@ struct Compiler
 	void addPushBackLHS( Production *prod, CodeVect &code, long &insertPos );
 
 	void prepGrammar();
-	struct pda_run *parsePattern( program_t *prg, tree_t **sp, const InputLoc &loc,
+	struct pda_run *parsePattern( program_t *prg, tree_t **sp,
 			int parserId, struct input_impl *sourceStream );
+	void patternError( const InputLoc &loc, struct pda_run *pdaRun );
+	program_t *patternProgram();
 	void parsePatterns();
 
 	void collectParserEls( LangElSet &parserEls );
 	void makeParser( LangElSet &parserEls );
 	PdaGraph *makePdaGraph( BstSet<LangEl*> &parserEls  );
 	struct pda_tables *makePdaTables( PdaGraph *pdaGraph );
+	struct pda_tables *makePrunedTables( struct pda_tables *t,
+			int *stateMap, long numReached );
+	void pruneOutput();
+	unsigned long pdaCacheDigest( LangElSet &parserEls );
+	bool loadPdaCache( LangElSet &parserEls, unsigned long digest );
+	void storePdaCache( LangElSet &parserEls, unsigned long digest );
 
 	void fillInPatterns( program_t *prg );
+	unsigned char *makeContainSets( long &width );
 	void makeRuntimeData();
 
 	/* Generate and write out the fsm. */
@@ -860,6 +886,7 @@ struct Compiler
 
 	void resolveUses();
 	void generateOutput( long activeRealm, bool includeCommit );
+	void generateOutputPart( OutputPart part, long activeRealm, bool includeCommit );
 	void compile();
 
 	void openNameSpace( ostream &out, Namespace *nspace );
@@ -932,6 +959,10 @@ struct Compiler
 	Production **prodIdIndex;
 	AlphSet literalSet;
 
+	/* Indexed by lel id while ordering actions. */
+	LelBitSet *followFirst;
+	bool *followFirstEpsilon;
+
 	PatList patternList;
 	ConsList replList;
 	ParserTextList parserTextList;
@@ -1044,6 +1075,7 @@ struct Compiler
 
 	long nextFrameId;
 	long nextParserId;
+	long numRuntimeParsers;
 
 	ObjectDef *rootLocalFrame;
 
@@ -1101,6 +1133,7 @@ struct Compiler
 };
 
 void afterOpMinimize( FsmGraph *fsm, bool lastInSeq = true );
+int compileThreads( long work );
 Key makeFsmKeyHex( char *str, const InputLoc &loc, Compiler *pd );
 Key makeFsmKeyDec( char *str, const InputLoc &loc, Compiler *pd );
 Key makeFsmKeyNum( char *str, const InputLoc &loc, Compiler *pd );
@@ -536,7 +536,7 @@ void Compiler::makeIgnoreCollectors()
 {
 	for ( RegionSetList::Iter regionSet = regionSetList; regionSet.lte(); regionSet++ ) {
 		if ( regionSet->collectIgnore->zeroLel == 0 ) {
-			String name( 128, "_ign_%p", regionSet->tokenIgnore );
+			String name( 128, "_ign_%d", regionSet->tokenIgnore->id );
 			LangEl *zeroLel = new LangEl( rootNamespace, name, LangEl::Term );
 			langEls.append( zeroLel );
 			zeroLel->isZero = true;
@@ -959,6 +959,9 @@ void Compiler::declareStreamFields( )
 	initFunction( uniqueTypeVoid, streamObj, ObjectMethod::Call, "auto_trim",
 			IN_INPUT_AUTO_TRIM_WC, IN_INPUT_AUTO_TRIM_WC, uniqueTypeBool, false );
 
+	initFunction( uniqueTypeVoid, streamObj, ObjectMethod::Call, "buffer",
+			IN_INPUT_OUT_BUF_WC, IN_INPUT_OUT_BUF_WC, uniqueTypeInt, false );
+
 	declareStreamField( streamObj, 0 );
 }
 
@@ -1536,6 +1539,15 @@ void Compiler::initParserFunctions( GenericType *gen )
 
 	initFunction( uniqueTypeInput, gen->objDef, ObjectMethod::Call, "gets",
 			IN_GET_PARSER_STREAM, IN_GET_PARSER_STREAM, true );
+
+	/* Queue the text of a previous parse with an edit applied, reusing the
+	 * top-level elements the edit does not touch. Args are the old tree, the
+	 * offset, the number of bytes deleted and the inserted text. */
+	UniqueType *reparseArgs[] = {
+		uniqueTypeAny, uniqueTypeInt, uniqueTypeInt, uniqueTypeStr
+	};
+	initFunction( uniqueTypeInt, 0, gen->objDef, ObjectMethod::Call, "reparse",
+			IN_SEND_REPARSE, IN_SEND_REPARSE, 4, reparseArgs, true, false, 0 );
 }
 
 void Compiler::initParserField( GenericType *gen, const char *name,
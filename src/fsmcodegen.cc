@@ -796,7 +796,7 @@ void FsmCodeGen::writeData()
 	out << "\n};\n\n";
 
 	out <<
-		"static struct fsm_tables fsmTables_start =\n"
+		SHARED() << "struct fsm_tables " << SHARED_NAME( "fsmTables_start" ) << " =\n"
 		"{\n"
 		"	0, "       /* actions */
 		" 0, "         /* keyOffsets */
@@ -855,7 +855,7 @@ void FsmCodeGen::writeExec()
 	setLabelsNeeded();
 
 	out <<
-		"static void fsm_execute( struct pda_run *pdaRun, struct input_impl *inputStream )\n"
+		SHARED() << "void " << SHARED_NAME( "fsm_execute" ) << "( struct pda_run *pdaRun, struct input_impl *inputStream )\n"
 		"{\n"
 		"	" << BLOCK_START() << " = pdaRun->p;\n"
 		"/*_resume:*/\n";
@@ -907,10 +907,10 @@ void FsmCodeGen::writeCode()
 	/* Referenced in the runtime lib, but used only in the compiler. Probably
 	 * should use the preprocessor to make these go away. */
 	out <<
-		"static void sendNamedLangEl( struct colm_program *prg, tree_t **tree,\n"
-		"		struct pda_run *pda_run, struct input_impl *input ) { }\n"
-		"static void initBindings( struct pda_run *pdaRun ) {}\n"
-		"static void popBinding( struct pda_run *pdaRun, parse_tree_t *tree ) {}\n"
+		SHARED() << "void " << SHARED_NAME( "sendNamedLangEl" ) << "( struct colm_program *prg, tree_t **tree,\n"
+		"		struct pda_run *pda_run, struct input_impl *input ) { }\n" <<
+		SHARED() << "void " << SHARED_NAME( "initBindings" ) << "( struct pda_run *pdaRun ) {}\n" <<
+		SHARED() << "void " << SHARED_NAME( "popBinding" ) << "( struct pda_run *pdaRun, parse_tree_t *tree ) {}\n"
 		"\n"
 		"\n";
 }
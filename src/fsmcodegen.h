@@ -120,6 +120,14 @@ protected:
 
 	string ENTRY_BY_REGION() { return DATA_PREFIX() + "entry_by_region"; }
 
+	/* Storage class and names of symbols the runtime data refers to. With
+	 * split output they are defined in one file and referenced from another,
+	 * so they are hidden and carry the object name. */
+	string SHARED()
+		{ return splitOutput ? "__attribute__((visibility(\"hidden\"))) " : "static "; }
+	string SHARED_NAME( const char *name )
+		{ return splitOutput ? string( objectName ) + "_" + name : string( name ); }
+
 
 	void INLINE_LIST( ostream &ret, InlineList *inlineList, 
 		int targState, bool inFinish );
@@ -50,6 +50,7 @@
 struct FsmTrans;
 struct FsmState;
 struct FsmGraph;
+struct HopcroftState;
 struct Action;
 struct TokenInstance;
 struct NameInst;
@@ -77,6 +78,15 @@ private:
 
 extern KeyOps *keyOps;
 
+/* Minimization algorithm applied after fsm operations. */
+enum MinimizeAlg
+{
+	MinimizePartition2,
+	MinimizeHopcroft
+};
+
+extern MinimizeAlg gblMinimizeAlg;
+
 /* Transistion Action Element. */
 typedef SBstMapEl< int, Action* > ActionTableEl;
 
@@ -519,6 +529,10 @@ struct FsmState
 		 * the state is in. */
 		MinPartition *partition;
 
+		/* When minimizing with Hopcroft's algorithm, the working data for
+		 * the state, which also holds the partition. */
+		HopcroftState *hopcroft;
+
 		/* When merging states (state machine operations) this next pointer is
 		 * used for the list of states that need to be filled in. */
 		FsmState *next;
@@ -1257,10 +1271,18 @@ struct FsmGraph
 	 * FSM Minimization
 	 */
 
+	/* Minimize using the algorithm selected by gblMinimizeAlg. */
+	void minimize();
+
 	/* Minimization by partitioning. */
 	void minimizePartition1();
 	void minimizePartition2();
 
+	/* Minimization by Hopcroft's worklist algorithm. Splits partitions only
+	 * by the in transitions of a splitter, giving O(n log n) partitioning
+	 * work. Finds the same partitions as minimizePartition2. */
+	void minimizeHopcroft();
+
 	/* Minimize the final state Machine. The result is the minimal fsm. Slow
 	 * but stable, correct minimization. Uses n^2 space (lookout) and average
 	 * n^2 time. Worst case n^3 time, but a that is a very rare case. */
@@ -1275,6 +1297,10 @@ struct FsmGraph
 	 * states that have identical out transitions. */
 	bool minimizeRound( );
 
+	/* Partition the states by final state status and transition data. Moves
+	 * the states off the main list. Returns the number of partitions. */
+	int initialPartition( FsmState **statePtrs, MinPartition *parts );
+
 	/* Given an intial partioning of states, split partitions that have out trans
 	 * to differing partitions. */
 	int partitionRound( FsmState **statePtrs, MinPartition *parts, int numParts );
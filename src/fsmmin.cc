@@ -26,6 +26,43 @@
 #include <mergesort.h>
 
 #include "fsmgraph.h"
+#include "global.h"
+
+int FsmGraph::initialPartition( FsmState **statePtrs, MinPartition *parts )
+{
+	/* Need a mergesort and an initial partition compare. */
+	MergeSort<FsmState*, InitPartitionCompare> mergeSort;
+	InitPartitionCompare initPartCompare;
+
+	/* Fill up an array of pointers to the states for easy sorting. */
+	int numStates = stateList.length();
+	StateList::Iter state = stateList;
+	for ( int s = 0; state.lte(); state++, s++ )
+		statePtrs[s] = state;
+		
+	/* Sort the states using the array of states. */
+	mergeSort.sort( statePtrs, numStates );
+
+	/* Assign the states into partitions. */
+	int destPart = 0;
+	for ( int s = 0; s < numStates; s++ ) {
+		/* If this state differs from the last then move to the next partition. */
+		if ( s > 0 && initPartCompare.compare( statePtrs[s-1], statePtrs[s] ) < 0 ) {
+			/* Move to the next partition. */
+			destPart += 1;
+		}
+
+		/* Put the state into its partition. */
+		statePtrs[s]->alg.partition = &parts[destPart];
+		parts[destPart].list.append( statePtrs[s] );
+	}
+
+	/* We just moved all the states from the main list into partitions without
+	 * taking them off the main list. So clean up the main list now. */
+	stateList.abandon();
+
+	return destPart + 1;
+}
 
 int FsmGraph::partitionRound( FsmState **statePtrs, MinPartition *parts, int numParts )
 {
@@ -83,10 +120,6 @@ int FsmGraph::partitionRound( FsmState **statePtrs, MinPartition *parts, int num
  */
 void FsmGraph::minimizePartition1()
 {
-	/* Need one mergesort object and partition compares. */
-	MergeSort<FsmState*, InitPartitionCompare> mergeSort;
-	InitPartitionCompare initPartCompare;
-
 	/* Nothing to do if there are no states. */
 	if ( stateList.length() == 0 )
 		return;
@@ -96,42 +129,12 @@ void FsmGraph::minimizePartition1()
 	 * transition functions. This gives us an initial partitioning to work
 	 * with.
 	 */
-
-	/* Make a array of pointers to states. */
 	int numStates = stateList.length();
 	FsmState** statePtrs = new FsmState*[numStates];
-
-	/* Fill up an array of pointers to the states for easy sorting. */
-	StateList::Iter state = stateList;
-	for ( int s = 0; state.lte(); state++, s++ )
-		statePtrs[s] = state;
-		
-	/* Sort the states using the array of states. */
-	mergeSort.sort( statePtrs, numStates );
-
-	/* An array of lists of states is used to partition the states. */
 	MinPartition *parts = new MinPartition[numStates];
-
-	/* Assign the states into partitions. */
-	int destPart = 0;
-	for ( int s = 0; s < numStates; s++ ) {
-		/* If this state differs from the last then move to the next partition. */
-		if ( s > 0 && initPartCompare.compare( statePtrs[s-1], statePtrs[s] ) < 0 ) {
-			/* Move to the next partition. */
-			destPart += 1;
-		}
-
-		/* Put the state into its partition. */
-		statePtrs[s]->alg.partition = &parts[destPart];
-		parts[destPart].list.append( statePtrs[s] );
-	}
-
-	/* We just moved all the states from the main list into partitions without
-	 * taking them off the main list. So clean up the main list now. */
-	stateList.abandon();
+	int numParts = initialPartition( statePtrs, parts );
 
 	/* Split partitions. */
-	int numParts = destPart + 1;
 	while ( true ) {
 		/* Test all partitions for splitting. */
 		int newNum = partitionRound( statePtrs, parts, numParts );
@@ -286,10 +289,6 @@ int FsmGraph::splitCandidates( FsmState **statePtrs, MinPartition *parts, int nu
  */
 void FsmGraph::minimizePartition2()
 {
-	/* Need a mergesort and an initial partition compare. */
-	MergeSort<FsmState*, InitPartitionCompare> mergeSort;
-	InitPartitionCompare initPartCompare;
-
 	/* Nothing to do if there are no states. */
 	if ( stateList.length() == 0 )
 		return;
@@ -299,52 +298,322 @@ void FsmGraph::minimizePartition2()
 	 * transition functions. This gives us an initial partitioning to work
 	 * with.
 	 */
-
-	/* Make a array of pointers to states. */
 	int numStates = stateList.length();
 	FsmState** statePtrs = new FsmState*[numStates];
+	MinPartition *parts = new MinPartition[numStates];
+	int numParts = initialPartition( statePtrs, parts );
 
-	/* Fill up an array of pointers to the states for easy sorting. */
-	StateList::Iter state = stateList;
-	for ( int s = 0; state.lte(); state++, s++ )
-		statePtrs[s] = state;
-		
-	/* Sort the states using the array of states. */
-	mergeSort.sort( statePtrs, numStates );
+	/* Split partitions. */
+	numParts = splitCandidates( statePtrs, parts, numParts );
+
+	/* Fuse states in the same partition. The states will end up back on the
+	 * main list. */
+	fusePartitions( parts, numParts );
+
+	/* Cleanup. */
+	delete[] statePtrs;
+	delete[] parts;
+}
+
+/* A state's transition on lowKey .. highKey into the current splitter. */
+struct HopcroftEntry
+{
+	HopcroftState *state;
+	Key lowKey, highKey;
+};
 
-	/* An array of lists of states is used to partition the states. */
+/* Working data for a state during Hopcroft minimization. */
+struct HopcroftState
+{
+	FsmState *state;
+	MinPartition *partition;
+	int index;
+
+	/* The normalized entries of the state in the current round. */
+	long first, length;
+};
+
+/* Orders entries by state, then by key, grouping the entries of each state. */
+struct HopcroftEntryCompare
+{
+	int compare( const HopcroftEntry &e1, const HopcroftEntry &e2 )
+	{
+		if ( e1.state->index < e2.state->index )
+			return -1;
+		else if ( e1.state->index > e2.state->index )
+			return 1;
+		else if ( e1.lowKey < e2.lowKey )
+			return -1;
+		else if ( e1.lowKey > e2.lowKey )
+			return 1;
+		return 0;
+	}
+};
+
+/* Orders touched states by partition, then by the keys they transition on
+ * into the splitter. States that compare equal stay together. */
+struct HopcroftStateCompare
+{
+	HopcroftEntry *entries;
+
+	int compare( const HopcroftState *s1, const HopcroftState *s2 )
+	{
+		if ( s1->partition < s2->partition )
+			return -1;
+		else if ( s1->partition > s2->partition )
+			return 1;
+
+		HopcroftEntry *e1 = entries + s1->first, *e2 = entries + s2->first;
+		for ( long e = 0; e < s1->length && e < s2->length; e++ ) {
+			if ( e1[e].lowKey < e2[e].lowKey )
+				return -1;
+			else if ( e1[e].lowKey > e2[e].lowKey )
+				return 1;
+			else if ( e1[e].highKey < e2[e].highKey )
+				return -1;
+			else if ( e1[e].highKey > e2[e].highKey )
+				return 1;
+		}
+
+		if ( s1->length < s2->length )
+			return -1;
+		else if ( s1->length > s2->length )
+			return 1;
+		return 0;
+	}
+};
+
+/* Splits partitions by the transitions entered since the last split. Partitions
+ * waiting on the worklist are marked active. */
+struct HopcroftSplitter
+{
+	HopcroftSplitter( MinPartition *parts, int numParts )
+		: parts(parts), numParts(numParts) {}
+
+	MinPartition *parts;
+	int numParts;
+
+	Vector<MinPartition*> worklist;
+	Vector<HopcroftEntry> entries;
+	Vector<HopcroftState*> touched;
+
+	void push( MinPartition *partition );
+	void enter( FsmState *state, Key lowKey, Key highKey );
+	void normalize();
+	void split();
+	void splitPartition( HopcroftStateCompare &compare, long first, long last );
+};
+
+void HopcroftSplitter::push( MinPartition *partition )
+{
+	if ( ! partition->active ) {
+		partition->active = true;
+		worklist.append( partition );
+	}
+}
+
+void HopcroftSplitter::enter( FsmState *state, Key lowKey, Key highKey )
+{
+	HopcroftEntry entry;
+	entry.state = state->alg.hopcroft;
+	entry.lowKey = lowKey;
+	entry.highKey = highKey;
+	entries.append( entry );
+}
+
+/* Group the entries by state and join neighbouring ranges. Equivalent states
+ * may break their transitions at different keys. */
+void HopcroftSplitter::normalize()
+{
+	MergeSort<HopcroftEntry, HopcroftEntryCompare> mergeSort;
+	mergeSort.sort( entries.data, entries.length() );
+
+	long dest = -1;
+	for ( long e = 0; e < entries.length(); e++ ) {
+		HopcroftState *hs = entries[e].state;
+		if ( dest < 0 || entries[dest].state != hs ) {
+			/* First entry of the state. */
+			dest += 1;
+			entries[dest] = entries[e];
+			hs->first = dest;
+			hs->length = 1;
+			touched.append( hs );
+		}
+		else {
+			Key next = entries[dest].highKey;
+			next.increment();
+			if ( entries[e].lowKey == next )
+				entries[dest].highKey = entries[e].highKey;
+			else {
+				dest += 1;
+				entries[dest] = entries[e];
+				hs->length += 1;
+			}
+		}
+	}
+}
+
+/* Split the partition of touched[first .. last) so that states stay together
+ * only if they transition on the same keys into the splitter. Untouched
+ * states enter on no keys and remain in the partition. */
+void HopcroftSplitter::splitPartition( HopcroftStateCompare &compare,
+		long first, long last )
+{
+	MinPartition *partition = touched[first]->partition;
+	int firstNewPart = numParts;
+
+	/* If every state was touched the first group stays behind. */
+	MinPartition *destPart = partition;
+	if ( last - first < partition->list.length() ) {
+		destPart = &parts[numParts];
+		numParts += 1;
+	}
+
+	for ( long s = first; s < last; s++ ) {
+		if ( s > first && compare.compare( touched[s-1], touched[s] ) < 0 ) {
+			destPart = &parts[numParts];
+			numParts += 1;
+		}
+
+		if ( destPart != partition ) {
+			FsmState *state = partition->list.detach( touched[s]->state );
+			destPart->list.append( state );
+		}
+	}
+
+	if ( numParts == firstNewPart )
+		return;
+
+	/* Fix the partition pointers after the transfer so the comparisons above
+	 * are not altered. Track the largest piece. */
+	MinPartition *largest = partition;
+	for ( int newPart = firstNewPart; newPart < numParts; newPart++ ) {
+		StateList::Iter state = parts[newPart].list;
+		for ( ; state.lte(); state++ )
+			state->alg.hopcroft->partition = &parts[newPart];
+
+		if ( parts[newPart].list.length() > largest->list.length() )
+			largest = &parts[newPart];
+	}
+
+	/* If the partition is still waiting to be a splitter then all the pieces
+	 * must be. Otherwise, splitting by all but the largest piece is
+	 * sufficient and keeps the work to O(n log n). */
+	if ( partition->active )
+		largest = 0;
+
+	if ( partition != largest )
+		push( partition );
+	for ( int newPart = firstNewPart; newPart < numParts; newPart++ ) {
+		if ( &parts[newPart] != largest )
+			push( &parts[newPart] );
+	}
+}
+
+/* Refine all partitions by the entries collected. */
+void HopcroftSplitter::split()
+{
+	normalize();
+
+	MergeSort<HopcroftState*, HopcroftStateCompare> mergeSort;
+	mergeSort.entries = entries.data;
+	mergeSort.sort( touched.data, touched.length() );
+
+	HopcroftStateCompare compare;
+	compare.entries = entries.data;
+
+	long first = 0;
+	for ( long s = 1; s <= touched.length(); s++ ) {
+		if ( s == touched.length() ||
+				touched[s]->partition != touched[first]->partition )
+		{
+			splitPartition( compare, first, s );
+			first = s;
+		}
+	}
+
+	entries.empty();
+	touched.empty();
+}
+
+/**
+ * \brief Minimize by Hopcroft's algorithm.
+ *
+ * Takes a partition off of a worklist and splits all partitions by the in
+ * transitions of its states. When a partition is split, only the smaller
+ * pieces need to go on the worklist. Produces the most minimal fsm possible.
+ */
+void FsmGraph::minimizeHopcroft()
+{
+	/* Nothing to do if there are no states. */
+	if ( stateList.length() == 0 )
+		return;
+
+	/* Start from the same partitioning as the other partition minimizations. */
+	int numStates = stateList.length();
+	FsmState** statePtrs = new FsmState*[numStates];
 	MinPartition *parts = new MinPartition[numStates];
+	int numParts = initialPartition( statePtrs, parts );
 
-	/* Assign the states into partitions. */
-	int destPart = 0;
+	HopcroftState *hopcroftStates = new HopcroftState[numStates];
 	for ( int s = 0; s < numStates; s++ ) {
-		/* If this state differs from the last then move to the next partition. */
-		if ( s > 0 && initPartCompare.compare( statePtrs[s-1], statePtrs[s] ) < 0 ) {
-			/* Move to the next partition. */
-			destPart += 1;
-		}
+		HopcroftState *hs = &hopcroftStates[s];
+		hs->state = statePtrs[s];
+		hs->partition = statePtrs[s]->alg.partition;
+		hs->index = s;
+		statePtrs[s]->alg.hopcroft = hs;
+	}
 
-		/* Put the state into its partition. */
-		statePtrs[s]->alg.partition = &parts[destPart];
-		parts[destPart].list.append( statePtrs[s] );
+	HopcroftSplitter hopcroft( parts, numParts );
+	for ( int p = 0; p < numParts; p++ )
+		hopcroft.push( &parts[p] );
+
+	/* The initial partitioning compares transition data only. Transitions
+	 * without a target separate states like transitions into a splitter. */
+	for ( int s = 0; s < numStates; s++ ) {
+		for ( TransList::Iter trans = statePtrs[s]->outList; trans.lte(); trans++ ) {
+			if ( trans->toState == 0 )
+				hopcroft.enter( statePtrs[s], trans->lowKey, trans->highKey );
+		}
 	}
+	hopcroft.split();
 
-	/* We just moved all the states from the main list into partitions without
-	 * taking them off the main list. So clean up the main list now. */
-	stateList.abandon();
+	while ( hopcroft.worklist.length() > 0 ) {
+		MinPartition *partition = hopcroft.worklist[hopcroft.worklist.length()-1];
+		hopcroft.worklist.remove( hopcroft.worklist.length()-1 );
+		partition->active = false;
 
-	/* Split partitions. */
-	int numParts = splitCandidates( statePtrs, parts, destPart+1 );
+		/* Enter the transitions into the states of the partition. */
+		for ( StateList::Iter state = partition->list; state.lte(); state++ ) {
+			for ( TransInList::Iter trans = state->inList; trans.lte(); trans++ )
+				hopcroft.enter( trans->fromState, trans->lowKey, trans->highKey );
+		}
+		hopcroft.split();
+	}
 
 	/* Fuse states in the same partition. The states will end up back on the
 	 * main list. */
-	fusePartitions( parts, numParts );
+	fusePartitions( parts, hopcroft.numParts );
 
 	/* Cleanup. */
+	delete[] hopcroftStates;
 	delete[] statePtrs;
 	delete[] parts;
 }
 
+/* Minimize with the algorithm selected on the command line. */
+void FsmGraph::minimize()
+{
+	double start = compileTime();
+
+	if ( gblMinimizeAlg == MinimizeHopcroft )
+		minimizeHopcroft();
+	else
+		minimizePartition2();
+
+	phaseSum( "minimize", compileTime() - start, "calls" );
+}
+
 void FsmGraph::initialMarkRound( MarkIndex &markIndex )
 {
 	/* P and q for walking pairs. */
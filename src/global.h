@@ -61,6 +61,21 @@ std::ostream &warning( int first_line, int first_column );
 
 extern std::ostream *outStream;
 extern bool printStatistics;
+extern int gblThreads;
+extern const char *pdaCacheDir;
+extern const char *profileFn;
+extern bool splitOutput;
+
+double compileTime();
+
+/* Compile phase profile. A phase runs from phaseBegin to phaseEnd and records
+ * wall time, growth of peak RSS and a count of the objects it made. Summed
+ * phases collect time from calls on any thread. Reported with -s as text and
+ * with --profile as JSON. */
+void phaseBegin( const char *name, bool children = false );
+void phaseEnd( long count, const char *countName );
+void phaseSum( const char *name, double time, const char *countName );
+void reportProfile();
 
 extern int gblErrorCount;
 extern bool gblLibrary;
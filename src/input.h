@@ -210,11 +210,28 @@ struct stream_impl_data
 	int lines_cur;
 
 	int auto_trim;
+
+	/* Output is gathered in out_buf and written in large chunks. If fd is set
+	 * the writes go straight to the descriptor instead of through file. */
+	int fd;
+	char *out_buf;
+	long out_len;
+	long out_size;
 };
 
+/* Stream options. */
+#define STREAM_OPT_AUTO_TRIM  0
+#define STREAM_OPT_OUT_BUF    1
+
+/* Default size of the output buffer. */
+#define STREAM_OUT_BUFSIZE    65536
+
 void stream_impl_push_line( struct stream_impl_data *ss, int ll );
 int stream_impl_pop_line( struct stream_impl_data *ss );
 
+void stream_impl_write( struct stream_impl_data *si, const char *data, long length );
+void stream_impl_flush_out( struct stream_impl_data *si );
+
 struct input_impl *colm_impl_new_generic( char *name );
 
 void update_position( struct stream_impl *input_stream, const char *data, long length );
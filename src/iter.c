@@ -366,7 +366,9 @@ rec_call:
 		*psp = sp;
 		return;
 	}
-	else {
+	else if ( any_tree || tree_can_contain( prg,
+			iter->ref.kid->tree->id, iter->search_id ) )
+	{
 		child = tree_child_maybe_ignore( prg, iter->ref.kid->tree, with_ignore );
 		if ( child != 0 ) {
 			vm_contiguous( 2 );
@@ -29,6 +29,7 @@
 #include <unistd.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/wait.h>
 #include <iostream>
 
 #include "debug.h"
@@ -180,6 +181,12 @@ void escapeLineDirectivePath( std::ostream &out, char *path );
 void scan( char *fileName, istream &input );
 
 bool printStatistics = false;
+int gblThreads = 0;
+const char *pdaCacheDir = 0;
+const char *profileFn = 0;
+bool splitOutput = false;
+bool ltoOutput = false;
+MinimizeAlg gblMinimizeAlg = MinimizePartition2;
 
 /* Print a summary of the options. */
 void usage()
@@ -204,6 +211,15 @@ void usage()
 "   -l                   activate logging\n"
 "   -r                   run output program and replace process\n"
 "   -c                   compile only (don't produce binary)\n"
+"   -j <n>               use <n> threads while compiling (default: all cpus)\n"
+"   -s                   print compile statistics\n"
+"   --minimize=<alg>     minimize scanners with <alg> (partition|hopcroft)\n"
+"   --cache-dir=<dir>    reuse parse tables cached in <dir> when the grammar\n"
+"                        is unchanged\n"
+"   --profile=<file>     write compile phase times and memory as JSON to <file>\n"
+"   --split-output       write the C output as several files (scanner, tables,\n"
+"                        bytecode, reducers) and compile them in parallel\n"
+"   --lto                compile the C output with link time optimization\n"
 "   -V                   print dot format (graphiz)\n"
 "   -d                   print verbose debug information\n"
 #if DEBUG
@@ -442,6 +458,155 @@ void runOutputProgram()
 	/* We shall never return here! */
 }
 
+/* The parts of split output that go into files of their own. The runtime part
+ * is written to the usual output file. */
+struct SplitFile
+{
+	OutputPart part;
+	const char *suffix;
+};
+
+SplitFile splitFiles[] = {
+	{ OutputScanner,  "-scanner.c" },
+	{ OutputTables,   "-tables.c" },
+	{ OutputBytecode, "-bytecode.c" },
+	{ OutputReducers, "-reducers.c" },
+};
+
+#define NUM_SPLIT_FILES ( sizeof(splitFiles) / sizeof(SplitFile) )
+
+const char *splitFns[NUM_SPLIT_FILES];
+
+/* Write split output. The stream for the runtime part must already be open.
+ * Returns the number of bytes written. */
+long generateSplitOutput( Compiler *pd )
+{
+	const char *stem = gblLibrary ? outputFn : binaryFn;
+	if ( stem == 0 ) {
+		error() << "--split-output requires an output file" << endl;
+		exit(1);
+	}
+
+	ostream *runtimeStream = outStream;
+	long emitted = 0;
+
+	for ( unsigned i = 0; i < NUM_SPLIT_FILES; i++ ) {
+		splitFns[i] = fileNameFromStem( stem, splitFiles[i].suffix );
+
+		ofstream *outFStream = new ofstream( splitFns[i] );
+		if ( !outFStream->is_open() ) {
+			error() << "error opening " << splitFns[i] << " for writing" << endl;
+			exit(1);
+		}
+
+		outStream = outFStream;
+		pd->generateOutputPart( splitFiles[i].part,
+				gblActiveRealm, ( commitCodeFn == 0 ) );
+		emitted += outStream->tellp();
+		delete outStream;
+	}
+
+	outStream = runtimeStream;
+	pd->generateOutputPart( OutputRuntime, gblActiveRealm, ( commitCodeFn == 0 ) );
+	emitted += outStream->tellp();
+
+	return emitted;
+}
+
+/* Run the commands at the same time. Returns non-zero if any failed. */
+int compileOutputParallel( char **commands, int numCommands )
+{
+	pid_t *pids = new pid_t[numCommands];
+
+	for ( int i = 0; i < numCommands; i++ ) {
+		if ( verbose )
+			cout << "compiling with: '" << commands[i] << "'" << endl;
+
+		pids[i] = fork();
+		if ( pids[i] == 0 ) {
+			execl( "/bin/sh", "sh", "-c", commands[i], (char*)0 );
+			_exit( 127 );
+		}
+	}
+
+	int res = 0;
+	for ( int i = 0; i < numCommands; i++ ) {
+		int status;
+		if ( pids[i] < 0 || waitpid( pids[i], &status, 0 ) < 0 ||
+				!WIFEXITED( status ) || WEXITSTATUS( status ) != 0 )
+			res = 1;
+	}
+
+	if ( res != 0 )
+		error() << "there was a problem compiling the output" << endl;
+
+	delete[] pids;
+	return res;
+}
+
+/* Compile each file of split output to an object. The objects are returned
+ * as a space separated list for the link. */
+char *compileSplitOutput( const char *compiler, const char *cflags, int &res )
+{
+	const char *ltoFlag = ltoOutput ? " -flto" : "";
+	const char *includeDir = buildDir != 0 ? buildDir : INCLUDEDIR;
+	const char *includeSuffix = buildDir != 0 ? "/src/include" : "";
+
+	int numFiles = NUM_SPLIT_FILES + 1;
+	const char **sources = new const char*[numFiles];
+	for ( unsigned i = 0; i < NUM_SPLIT_FILES; i++ )
+		sources[i] = splitFns[i];
+	sources[NUM_SPLIT_FILES] = intermedFn;
+
+	int includeLength = 0;
+	for ( ArgsVector::Iter ip = includePaths; ip.lte(); ip++ )
+		includeLength += strlen( *ip ) + 3;
+
+	char **commands = new char*[numFiles];
+	int objectsLength = 1;
+	for ( int i = 0; i < numFiles; i++ ) {
+		char *object = fileNameFromStem( sources[i], ".o" );
+		objectsLength += strlen( object ) + 1;
+
+		int length = 1024 + strlen( compiler ) + strlen( cflags ) +
+				strlen( object ) + strlen( sources[i] ) +
+				strlen( includeDir ) + includeLength;
+		commands[i] = new char[length];
+		sprintf( commands[i],
+				"%s -Wall -Wwrite-strings"
+				" -g %s%s"
+				" -c -o %s"
+				" %s"
+				" -I%s%s",
+				compiler, cflags, ltoFlag,
+				object, sources[i],
+				includeDir, includeSuffix );
+		for ( ArgsVector::Iter ip = includePaths; ip.lte(); ip++ ) {
+			strcat( commands[i], " -I" );
+			strcat( commands[i], *ip );
+		}
+
+		delete[] object;
+	}
+
+	res = compileOutputParallel( commands, numFiles );
+
+	char *objects = new char[objectsLength];
+	objects[0] = 0;
+	for ( int i = 0; i < numFiles; i++ ) {
+		char *object = fileNameFromStem( sources[i], ".o" );
+		if ( i > 0 )
+			strcat( objects, " " );
+		strcat( objects, object );
+		delete[] object;
+		delete[] commands[i];
+	}
+
+	delete[] commands;
+	delete[] sources;
+	return objects;
+}
+
 void compileOutput()
 {
 	const char *compiler = getenv( "CC" );
@@ -452,8 +617,26 @@ void compileOutput()
 	if ( cflags == 0 )
 		cflags = "";
 
+	phaseBegin( "cc", true );
+
+	/* With split output the files are compiled first and only the objects
+	 * go into the final command. */
+	char *objects = 0;
+	if ( splitOutput ) {
+		int res = 0;
+		objects = compileSplitOutput( compiler, cflags, res );
+		if ( res != 0 ) {
+			phaseEnd( NUM_SPLIT_FILES + 1, "files" );
+			delete[] objects;
+			return;
+		}
+	}
+
+	const char *inputs = objects != 0 ? objects : intermedFn;
+	const char *ltoFlag = ltoOutput ? " -flto" : "";
+
 	int length = 1024 + strlen( compiler ) + strlen( cflags ) + 
-			strlen( intermedFn ) + strlen( binaryFn );
+			strlen( inputs ) + strlen( binaryFn );
 	for ( ArgsVector::Iter af = additionalCodeFiles; af.lte(); af++ )
 		length += strlen( *af ) + 2;
 	for ( ArgsVector::Iter ip = includePaths; ip.lte(); ip++ )
@@ -463,7 +646,7 @@ void compileOutput()
 	if ( buildDir != 0 )
 		length += strlen( buildDir ) * 3;
 #define COMPILE_COMMAND_STRING "%s -Wall -Wwrite-strings" \
-		" -g %s" \
+		" -g %s%s" \
 		" -o %s" \
 		" %s"
 	char *command = new char[length];
@@ -474,8 +657,8 @@ void compileOutput()
 				" -I%s/src/include"
 				" -static"
 				" %s/src/libcolm.la",
-				buildDir, compiler, cflags,
-				binaryFn, intermedFn,
+				buildDir, compiler, cflags, ltoFlag,
+				binaryFn, inputs,
 				buildDir, buildDir );
 	}
 	else {
@@ -484,8 +667,8 @@ void compileOutput()
 				" -I" INCLUDEDIR
 				" -L" LIBDIR
 				" -Wl,-rpath," LIBDIR,
-				compiler, cflags,
-				binaryFn, intermedFn );
+				compiler, cflags, ltoFlag,
+				binaryFn, inputs );
 	}
 #undef COMPILE_COMMAND_STRING
 	for ( ArgsVector::Iter af = additionalCodeFiles; af.lte(); af++ ) {
@@ -504,15 +687,22 @@ void compileOutput()
 	if ( buildDir == 0 )
 		strcat( command, " -lcolm" );
 
-	if( !compileOutputCommand( command ) && run )
+	int res = compileOutputCommand( command );
+	phaseEnd( additionalCodeFiles.length() +
+			( splitOutput ? NUM_SPLIT_FILES + 1 : 1 ), "files" );
+
+	if ( res == 0 && run ) {
+		reportProfile();
 		runOutputProgram();
+	}
 
 	delete[] command;
+	delete[] objects;
 }
 
 void processArgs( int argc, const char **argv )
 {
-	ParamCheck pc( "p:cD:e:x:I:L:vdliro:S:M:vHh?-:sVa:m:b:E:B:", argc, argv );
+	ParamCheck pc( "p:cD:e:x:I:L:vdliro:S:M:vHh?-:sVa:m:b:E:B:j:", argc, argv );
 
 	while ( pc.check() ) {
 		switch ( pc.state ) {
@@ -572,6 +762,11 @@ void processArgs( int argc, const char **argv )
 			case 's':
 				printStatistics = true;
 				break;
+			case 'j':
+				gblThreads = atoi( pc.parameterArg );
+				if ( gblThreads <= 0 )
+					error() << "-j requires a positive number of threads" << endl;
+				break;
 			case 'V':
 				generateGraphviz = true;
 				break;
@@ -584,6 +779,26 @@ void processArgs( int argc, const char **argv )
 					version();
 					exit(0);
 				}
+				else if ( strcasecmp(pc.parameterArg, "minimize=partition") == 0 )
+					gblMinimizeAlg = MinimizePartition2;
+				else if ( strcasecmp(pc.parameterArg, "minimize=hopcroft") == 0 )
+					gblMinimizeAlg = MinimizeHopcroft;
+				else if ( strncasecmp(pc.parameterArg, "profile=", 8) == 0 ) {
+					if ( pc.parameterArg[8] == 0 )
+						error() << "a zero length profile file name was given" << endl;
+					else
+						profileFn = pc.parameterArg + 8;
+				}
+				else if ( strcasecmp(pc.parameterArg, "split-output") == 0 )
+					splitOutput = true;
+				else if ( strcasecmp(pc.parameterArg, "lto") == 0 )
+					ltoOutput = true;
+				else if ( strncasecmp(pc.parameterArg, "cache-dir=", 10) == 0 ) {
+					if ( pc.parameterArg[10] == 0 )
+						error() << "a zero length cache directory was given" << endl;
+					else
+						pdaCacheDir = pc.parameterArg + 10;
+				}
 				else {
 					error() << "--" << pc.parameterArg <<
 							" is an invalid argument" << endl;
@@ -762,7 +977,9 @@ int main(int argc, const char **argv)
 	BaseParser *parser = consLoadColm( pd, inputFn );
 #endif
 
+	phaseBegin( "parse" );
 	parser->go( gblActiveRealm );
+	phaseEnd( pd->prodList.length(), "productions" );
 
 	/* Parsing complete, check for errors.. */
 	if ( gblErrorCount > 0 )
@@ -784,7 +1001,16 @@ int main(int argc, const char **argv)
 		else
 			openOutputCompiled();
 
-		pd->generateOutput( gblActiveRealm, ( commitCodeFn == 0 ) );
+		phaseBegin( "emit" );
+		long emitted;
+		if ( splitOutput )
+			emitted = generateSplitOutput( pd );
+		else {
+			pd->generateOutput( gblActiveRealm, ( commitCodeFn == 0 ) );
+			emitted = outStream->tellp();
+		}
+		phaseEnd( emitted > 0 ? emitted : 0, "bytes" );
+
 		if ( outStream != 0 )
 			delete outStream;
 
@@ -811,6 +1037,8 @@ int main(int argc, const char **argv)
 	delete parser;
 	delete pd;
 
+	reportProfile();
+
 	/* Bail on above errors. */
 	if ( gblErrorCount > 0 )
 		exit(1);
@@ -0,0 +1,191 @@
+/*
+ * Copyright 2007-2018 Adrian Thurston <thurston@colm.net>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * Parallel parsing of independently delimitable input.
+ *
+ * Record oriented input can be split at a delimiter that only occurs between
+ * top-level records. Each chunk then parses from the start state on its own.
+ * The chunks are handed out to a pool of worker threads, each owning its own
+ * program instance, and with it its own kid, tree, parse tree and head pools.
+ * All the programs share the one read-only colm_sections. Trees belong to the
+ * pools of the program that made them, so results are stitched back in order
+ * by the caller, who stores whatever the chunk callback produces (reducer
+ * output, printed trees) in a slot indexed by chunk number.
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+#include <colm/colm.h>
+#include <colm/program.h>
+
+struct chunk_pool
+{
+	const char *data;
+	long nchunks;
+	const long *ends;
+	colm_chunk_fn fn;
+	void *arg;
+
+	pthread_mutex_t mutex;
+	long next;
+};
+
+struct chunk_worker
+{
+	pthread_t thread;
+	struct chunk_pool *pool;
+	struct colm_program *prg;
+};
+
+static long find_delim( const char *data, long length,
+		const char *delim, long delim_len, long from )
+{
+	long i;
+	for ( i = from; i + delim_len <= length; i++ ) {
+		if ( data[i] == delim[0] && memcmp( data + i, delim, delim_len ) == 0 )
+			return i;
+	}
+	return -1;
+}
+
+/*
+ * Split data into at most max_chunks chunks of roughly equal size. Each chunk
+ * but the last ends immediately after an occurrence of the delimiter. Chunk
+ * end offsets are written to ends and the number of chunks is returned.
+ */
+long colm_split_chunks( const char *data, long length,
+		const char *delim, long delim_len, long max_chunks, long *ends )
+{
+	long n = 0, start = 0;
+
+	if ( max_chunks < 1 )
+		return 0;
+
+	long target = length / max_chunks;
+	if ( target < 1 )
+		target = 1;
+
+	while ( start < length && n < max_chunks - 1 ) {
+		long from = start + target - delim_len;
+		if ( from < start )
+			from = start;
+
+		long pos = delim_len > 0 ?
+				find_delim( data, length, delim, delim_len, from ) : -1;
+		if ( pos < 0 )
+			break;
+
+		ends[n++] = pos + delim_len;
+		start = pos + delim_len;
+	}
+
+	if ( start < length || n == 0 )
+		ends[n++] = length;
+
+	return n;
+}
+
+static void *chunk_worker_run( void *arg )
+{
+	struct chunk_worker *worker = (struct chunk_worker*) arg;
+	struct chunk_pool *pool = worker->pool;
+
+	while ( 1 ) {
+		pthread_mutex_lock( &pool->mutex );
+		long chunk = pool->next;
+		if ( chunk < pool->nchunks )
+			pool->next += 1;
+		pthread_mutex_unlock( &pool->mutex );
+
+		if ( chunk >= pool->nchunks )
+			break;
+
+		long start = chunk == 0 ? 0 : pool->ends[chunk-1];
+		pool->fn( worker->prg, chunk, pool->data + start,
+				pool->ends[chunk] - start, pool->arg );
+	}
+
+	return 0;
+}
+
+/*
+ * Call fn for each chunk on a pool of threads. The programs are created on
+ * the calling thread before any worker starts and deleted after all have
+ * joined. A program is used by one worker only, for all chunks that worker
+ * takes. Returns the number of threads started, zero if the chunks were all
+ * processed on the calling thread.
+ */
+int colm_parse_chunks( struct colm_sections *rtd, int threads,
+		const char *data, long nchunks, const long *ends,
+		colm_chunk_fn fn, void *arg )
+{
+	struct chunk_pool pool;
+	struct chunk_worker *workers;
+	int t, started = 0;
+
+	if ( threads < 1 )
+		threads = 1;
+	if ( threads > nchunks )
+		threads = nchunks;
+	if ( threads == 0 )
+		return 0;
+
+	pool.data = data;
+	pool.nchunks = nchunks;
+	pool.ends = ends;
+	pool.fn = fn;
+	pool.arg = arg;
+	pool.next = 0;
+	pthread_mutex_init( &pool.mutex, 0 );
+
+	workers = malloc( sizeof(struct chunk_worker) * threads );
+	for ( t = 0; t < threads; t++ ) {
+		workers[t].pool = &pool;
+		workers[t].prg = colm_new_program( rtd );
+	}
+
+	for ( t = 0; t < threads; t++ ) {
+		if ( pthread_create( &workers[t].thread, 0,
+				&chunk_worker_run, &workers[t] ) != 0 )
+			break;
+		started += 1;
+	}
+
+	/* If a thread could not be started the ones that did still drain the
+	 * queue. With none started do the work here. */
+	if ( started == 0 )
+		chunk_worker_run( &workers[0] );
+
+	for ( t = 0; t < started; t++ )
+		pthread_join( workers[t].thread, 0 );
+
+	for ( t = 0; t < threads; t++ )
+		colm_delete_program( workers[t].prg );
+
+	free( workers );
+	pthread_mutex_destroy( &pool.mutex );
+
+	return started;
+}
@@ -445,8 +445,6 @@ void RegionImpl::runLongestMatch( Compiler *pd, FsmGraph *graph )
 	for ( Vector<FsmTrans*>::Iter rs = restartTrans; rs.lte(); rs++ )
 		restart( graph, *rs );
 
-	int lmErrActionOrd = pd->curActionOrd++;
-
 	/* Embed the error for recognizing a char. */
 	for ( StateList::Iter st = graph->stateList; st.lte(); st++ ) {
 		if ( st->lmItemSet.length() == 1 && st->lmItemSet[0] != 0 ) {
@@ -494,11 +492,13 @@ void RegionImpl::transferScannerLeavingActions( FsmGraph *graph )
 	}
 }
 
-FsmGraph *RegionImpl::walk( Compiler *pd )
+/* Build the machine of each token. This draws action ordering numbers from
+ * the compiler, so regions are walked one after another. */
+void RegionImpl::walkTokens( Compiler *pd )
 {
 	/* Make each part of the longest match. */
-	int numParts = 0;
-	FsmGraph **parts = new FsmGraph*[tokenInstanceList.length()];
+	numParts = 0;
+	parts = new FsmGraph*[tokenInstanceList.length()];
 	for ( TokenInstanceListReg::Iter lmi = tokenInstanceList; lmi.lte(); lmi++ ) {
 		/* Watch out for patternless tokens. */
 		if ( lmi->join != 0 ) {
@@ -514,17 +514,11 @@ FsmGraph *RegionImpl::walk( Compiler *pd )
 			numParts += 1;
 		}
 	}
-	FsmGraph *retFsm = parts[0];
 
 	if ( defaultTokenInstance != 0 && defaultTokenInstance->tokenDef->tdLangEl->isIgnore )
 		error() << "ignore token cannot be a scanner's zero-length token" << endp;
 
-	/* The region is empty. Return the empty set. */
-	if ( numParts == 0 ) {
-		retFsm = new FsmGraph();
-		retFsm->lambdaFsm();
-	}
-	else {
+	if ( numParts > 0 ) {
 		/* Before we union the patterns we need to deal with leaving actions. They
 		 * are transfered to error transitions out of the final states (like local
 		 * error actions) and to eof actions. In the scanner we need to forbid
@@ -532,17 +526,36 @@ FsmGraph *RegionImpl::walk( Compiler *pd )
 		for ( int i = 0; i < numParts; i++ )
 			transferScannerLeavingActions( parts[i] );
 
+		/* Taken now so the numbering does not depend on the join order. */
+		lmErrActionOrd = pd->curActionOrd++;
+	}
+}
+
+/* Union the token machines into the scanner. Touches only this region's
+ * graphs and objects, so regions can be joined concurrently. */
+FsmGraph *RegionImpl::joinTokens( Compiler *pd )
+{
+	FsmGraph *retFsm;
+
+	/* The region is empty. Return the empty set. */
+	if ( numParts == 0 ) {
+		retFsm = new FsmGraph();
+		retFsm->lambdaFsm();
+	}
+	else {
 		/* Union machines one and up with machine zero. */
-		FsmGraph *retFsm = parts[0];
+		retFsm = parts[0];
 		for ( int i = 1; i < numParts; i++ ) {
 			retFsm->unionOp( parts[i] );
 			afterOpMinimize( retFsm );
 		}
 
 		runLongestMatch( pd, retFsm );
-		delete[] parts;
 	}
 
+	delete[] parts;
+	parts = 0;
+
 	/* Need the entry point for the region. */
 	retFsm->setEntry( regionNameInst->id, retFsm->startState );
 
@@ -1366,18 +1379,18 @@ FsmGraph *ReItem::walk( Compiler *pd, RegExpr *rootRegex )
 				rtnVal = new FsmGraph();
 				rtnVal->lambdaFsm();
 			}
-			rtnVal->minimizePartition2();
+			rtnVal->minimize();
 			break;
 		}
 		case NegOrBlock: {
 			/* Get the or block and minimize it. */
 			FsmGraph *fsm = orBlock->walk( pd, rootRegex );
-			fsm->minimizePartition2();
+			fsm->minimize();
 
 			/* Make a dot fsm and subtract from it. */
 			rtnVal = dotFsm( pd );
 			rtnVal->subtractOp( fsm );
-			rtnVal->minimizePartition2();
+			rtnVal->minimize();
 			break;
 		}
 	}
@@ -1473,7 +1486,7 @@ FsmGraph *ReOrItem::walk( Compiler *pd, RegExpr *rootRegex )
 				FsmGraph *otherRange = new FsmGraph();
 				otherRange->rangeFsm( otherLow, otherHigh );
 				rtnVal->unionOp( otherRange );
-				rtnVal->minimizePartition2();
+				rtnVal->minimize();
 			}
 			else if ( lowKey <= 'z' && 'a' <= highKey ) {
 				Key otherLow = lowKey < 'a' ? Key('a') : lowKey;
@@ -1485,7 +1498,7 @@ FsmGraph *ReOrItem::walk( Compiler *pd, RegExpr *rootRegex )
 				FsmGraph *otherRange = new FsmGraph();
 				otherRange->rangeFsm( otherLow, otherHigh );
 				rtnVal->unionOp( otherRange );
-				rtnVal->minimizePartition2();
+				rtnVal->minimize();
 			}
 		}
 
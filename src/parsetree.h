@@ -638,7 +638,10 @@ struct RegionImpl
 		lmActSelect(0),
 		lmSwitchHandlesError(false),
 		defaultTokenInstance(0),
-		wasEmpty(false)
+		wasEmpty(false),
+		parts(0),
+		numParts(0),
+		lmErrActionOrd(0)
 	{}
 
 	InputLoc loc;
@@ -656,11 +659,17 @@ struct RegionImpl
 	 * then wasEmpty is true. */
 	bool wasEmpty;
 
+	/* Token machines, between walkTokens and joinTokens. */
+	FsmGraph **parts;
+	int numParts;
+	int lmErrActionOrd;
+
 	RegionImpl *prev, *next;
 
 	void runLongestMatch( Compiler *pd, FsmGraph *graph );
 	void transferScannerLeavingActions( FsmGraph *graph );
-	FsmGraph *walk( Compiler *pd );
+	void walkTokens( Compiler *pd );
+	FsmGraph *joinTokens( Compiler *pd );
 
 	void restart( FsmGraph *graph, FsmTrans *trans );
 	void makeNameTree( const InputLoc &loc, Compiler *pd );
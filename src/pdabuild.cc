@@ -35,6 +35,7 @@
 /* Parsing. */
 #include "compiler.h"
 #include "pdacodegen.h"
+#include "redfsm.h"
 
 using std::endl;
 using std::cerr;
@@ -374,7 +375,7 @@ void Compiler::makeProdFsms()
  * it and over tab. If overSrc is the end of the production, find the follow
  * from the table, taking only the characters on which the parent is reduced.
  * */
-void Compiler::findFollow( AlphSet &result, PdaState *overTab, 
+void Compiler::findFollow( LelBitSet &result, PdaState *overTab, 
 		PdaState *overSrc, Production *parentDef )
 {
 	if ( overSrc->isFinState() ) {
@@ -397,24 +398,15 @@ void Compiler::findFollow( AlphSet &result, PdaState *overTab,
 
 		LangEl *langEl = langElIndex[pastTrans->key];
 		if ( langEl != 0 && langEl->type == LangEl::NonTerm ) {
-			bool hasEpsilon = false;
-			for ( LelProdList::Iter def = langEl->prodList; def.lte(); def++ ) {
-				result.insert( def->firstSet );
-
-				if ( def->firstSet.find( -1 ) )
-					hasEpsilon = true;
-			}
+			/* First sets of all the productions, plus the dup. */
+			result.insert( followFirst[langEl->id] );
 
 			/* Find the equivalent state in the parser. */
-			if ( hasEpsilon ) {
+			if ( followFirstEpsilon[langEl->id] ) {
 				PdaTrans *tabTrans = overTab->findTrans( pastTrans->key );
 				findFollow( result, tabTrans->toState, 
 						pastTrans->value->toState, parentDef );
 			}
-
-			/* Now possibly the dup. */
-			if ( langEl->termDup != 0 )
-				result.insert( langEl->termDup->id );
 		}
 		else {
 			result.insert( pastTrans->key );
@@ -422,6 +414,35 @@ void Compiler::findFollow( AlphSet &result, PdaState *overTab,
 	}
 }
 
+/* For each non-terminal, the union of its productions' first sets and its
+ * terminal dup, as findFollow needs it. The epsilon marker is kept apart. */
+void Compiler::makeFollowFirstSets()
+{
+	followFirst = new LelBitSet[nextLelId];
+	followFirstEpsilon = new bool[nextLelId];
+
+	for ( long i = 0; i < nextLelId; i++ ) {
+		LangEl *langEl = langElIndex[i];
+		followFirst[i].setSize( nextLelId );
+		followFirstEpsilon[i] = false;
+
+		if ( langEl == 0 || langEl->type != LangEl::NonTerm )
+			continue;
+
+		for ( LelProdList::Iter def = langEl->prodList; def.lte(); def++ ) {
+			for ( AlphSet::Iter f = def->firstSet; f.lte(); f++ ) {
+				if ( *f == -1 )
+					followFirstEpsilon[i] = true;
+				else
+					followFirst[i].insert( *f );
+			}
+		}
+
+		if ( langEl->termDup != 0 )
+			followFirst[i].insert( langEl->termDup->id );
+	}
+}
+
 PdaState *Compiler::followProd( PdaState *tabState, PdaState *prodState )
 {
 	while ( prodState->transMap.length() == 1 ) {
@@ -460,7 +481,8 @@ void Compiler::pdaOrderFollow( LangEl *rootEl, PdaState *tabState,
 	PdaState *overTab = tabTrans->toState;
 	PdaState *overSrc = srcTrans->toState;
 
-	AlphSet alphSet;
+	LelBitSet alphSet;
+	alphSet.setSize( nextLelId );
 	if ( parentDef == rootEl->rootDef )
 		alphSet.insert( rootEl->eofLel->id );
 	else
@@ -641,6 +663,8 @@ void Compiler::pdaActionOrder( PdaGraph *pdaGraph, LangElSet &parserEls )
 		}
 	}
 
+	makeFollowFirstSets();
+
 	/* Compute the action orderings, record the max value. */
 	long time = 1;
 	for ( LangElSet::Iter pe = parserEls; pe.lte(); pe++ ) {
@@ -654,6 +678,11 @@ void Compiler::pdaActionOrder( PdaGraph *pdaGraph, LangElSet &parserEls )
 		eofTrans->actOrds[0] = time++;
 	}
 
+	delete[] followFirst;
+	delete[] followFirstEpsilon;
+	followFirst = 0;
+	followFirstEpsilon = 0;
+
 	for ( PdaStateList::Iter state = pdaGraph->stateList; state.lte(); state++ ) {
 		if ( state->regions.length() == 0 ) {
 			for ( TransMap::Iter tel = state->transMap; tel.lte(); tel++ ) {
@@ -1332,6 +1361,62 @@ short *Compiler::makeTrees( ObjectDef *objectDef, int &numTrees )
 }
 
 
+/*
+ * For each nonterminal, the set of language element ids that can appear in a
+ * tree beneath it. One row of bits per nonterminal. Tree iterators use it to
+ * skip subtrees that cannot hold what they search for. A nonterminal that was
+ * sent to a parser as a token through its term dup keeps its own id in the
+ * tree, so a term dup in a production stands for its nonterminal.
+ */
+unsigned char *Compiler::makeContainSets( long &width )
+{
+	width = ( nextLelId + 7 ) / 8;
+	long rows = nextLelId - firstNonTermId;
+	unsigned char *sets = new unsigned char[rows * width];
+	memset( sets, 0, rows * width );
+
+	bool modified = true;
+	while ( modified ) {
+		modified = false;
+		for ( ProdList::Iter prod = prodList; prod.lte(); prod++ ) {
+			unsigned char *row = sets + ( prod->prodName->id - firstNonTermId ) * width;
+			for ( ProdElList::Iter el = *prod->prodElList; el.lte(); el++ ) {
+				LangEl *lel = el->langEl;
+				if ( lel->id < firstNonTermId && lel->termDup != 0 )
+					lel = lel->termDup;
+
+				if ( lel == anyLangEl ) {
+					for ( long b = 0; b < width; b++ ) {
+						if ( row[b] != 0xff ) {
+							row[b] = 0xff;
+							modified = true;
+						}
+					}
+					continue;
+				}
+
+				unsigned char bit = 1 << ( lel->id & 7 );
+				if ( ! ( row[lel->id >> 3] & bit ) ) {
+					row[lel->id >> 3] |= bit;
+					modified = true;
+				}
+
+				if ( lel->id >= firstNonTermId ) {
+					unsigned char *sub = sets + ( lel->id - firstNonTermId ) * width;
+					for ( long b = 0; b < width; b++ ) {
+						if ( ( row[b] | sub[b] ) != row[b] ) {
+							row[b] |= sub[b];
+							modified = true;
+						}
+					}
+				}
+			}
+		}
+	}
+
+	return sets;
+}
+
 void Compiler::makeRuntimeData()
 {
 	long count = 0;
@@ -1511,6 +1596,8 @@ void Compiler::makeRuntimeData()
 		}
 	}
 
+	runtimeData->contain_sets = makeContainSets( runtimeData->contain_width );
+
 	/*
 	 * struct_el_info
 	 */
@@ -1952,26 +2039,41 @@ void Compiler::fillInPatterns( program_t *prg )
 }
 
 
-int Compiler::findIndexOff( struct pda_tables *pdaTables, PdaGraph *pdaGraph, PdaState *state, int &curLen )
+#define TAKEN_BITS ( sizeof(unsigned long) * 8 )
+
+/* The taken flags of the TAKEN_BITS index slots starting at pos. */
+static inline unsigned long takenFrom( unsigned long *taken, long pos )
 {
-	for ( int start = 0; start < curLen;  ) {
-		int offset = start;
-		for ( TransMap::Iter trans = state->transMap; trans.lte(); trans++ ) {
-			if ( pdaTables->owners[offset] != -1 )
-				goto next_start;
+	long w = pos / TAKEN_BITS, b = pos % TAKEN_BITS;
+	if ( b == 0 )
+		return taken[w];
+	return ( taken[w] >> b ) | ( taken[w+1] << ( TAKEN_BITS - b ) );
+}
 
-			offset++;
-			if ( ! trans.last() ) {
-				TransMap::Iter next = trans.next();
-				offset += next->key - trans->key - 1;
+/* First fit of a state's transitions into the index. The spans are the key
+ * offsets of the transitions from the first one. Candidate starts are tested
+ * a word at a time: a bit survives only if every transition lands on a free
+ * slot from that start. */
+int Compiler::findIndexOff( unsigned long *taken, int *spans,
+		int numSpans, int &curLen )
+{
+	if ( numSpans == 0 )
+		return 0;
+
+	for ( int start = 0; start < curLen; start += TAKEN_BITS ) {
+		unsigned long fits = ~0UL;
+		for ( int t = 0; t < numSpans && fits != 0; t++ )
+			fits &= ~takenFrom( taken, start + spans[t] );
+
+		if ( fits != 0 ) {
+			/* Got though the whole list without a conflict. */
+			int found = start;
+			while ( ( fits & 1 ) == 0 ) {
+				fits >>= 1;
+				found += 1;
 			}
+			return found < curLen ? found : curLen;
 		}
-
-		/* Got though the whole list without a conflict. */
-		return start;
-
-next_start:
-		start++;
 	}
 
 	return curLen;
@@ -2040,16 +2142,21 @@ struct pda_tables *Compiler::makePdaTables( PdaGraph *pdaGraph )
 
 	/* Allocate indices and owners. */
 	pdaTables->num_indices = count;
-	pdaTables->indices = new int[count];
-	pdaTables->owners = new int[count];
+	int *indices = new int[count];
+	int *owners = new int[count];
 	for ( long i = 0; i < count; i++ ) {
-		pdaTables->indices[i] = -1;
-		pdaTables->owners[i] = -1;
+		indices[i] = -1;
+		owners[i] = -1;
 	}
 
+	/* Owned slots, as bits. Padded so a word read past the end is free. */
+	long takenLen = count / TAKEN_BITS + 2;
+	unsigned long *taken = new unsigned long[takenLen];
+	memset( taken, 0, sizeof(unsigned long) * takenLen );
+
 	/* Allocate offsets. */
 	int numStates = pdaGraph->stateList.length(); 
-	pdaTables->offsets = new unsigned int[numStates];
+	unsigned int *offsets = new unsigned int[numStates];
 	pdaTables->num_states = numStates;
 
 	/* Place transitions into indices/owners */
@@ -2063,30 +2170,39 @@ struct pda_tables *Compiler::makePdaTables( PdaGraph *pdaGraph )
 	//MergeSort< PdaState*, CmpSpan > mergeSort;
 	//mergeSort.sort( states, numStates );
 	
+	int maxTrans = 0;
+	for ( int s = 0; s < numStates; s++ ) {
+		if ( states[s]->transMap.length() > maxTrans )
+			maxTrans = states[s]->transMap.length();
+	}
+	int *spans = new int[maxTrans];
+
 	int indLen = 0;
 	for ( int s = 0; s < numStates; s++ ) {
 		PdaState *state = states[s];
 
-		int indOff = findIndexOff( pdaTables, pdaGraph, state, indLen );
-		pdaTables->offsets[state->stateNum] = indOff;
+		int numSpans = 0;
+		for ( TransMap::Iter trans = state->transMap; trans.lte(); trans++ )
+			spans[numSpans++] = trans->key - state->transMap.data[0].key;
 
-		for ( TransMap::Iter trans = state->transMap; trans.lte(); trans++ ) {
-			pdaTables->indices[indOff] = trans->value->actionSetEl->key.id;
-			pdaTables->owners[indOff] = state->stateNum;
-			indOff++;
+		int indOff = findIndexOff( taken, spans, numSpans, indLen );
+		offsets[state->stateNum] = indOff;
 
-			if ( ! trans.last() ) {
-				TransMap::Iter next = trans.next();
-				indOff += next->key - trans->key - 1;
-			}
+		for ( TransMap::Iter trans = state->transMap; trans.lte(); trans++ ) {
+			int pos = indOff + spans[trans.pos()];
+			indices[pos] = trans->value->actionSetEl->key.id;
+			owners[pos] = state->stateNum;
+			taken[pos / TAKEN_BITS] |= 1UL << ( pos % TAKEN_BITS );
 		}
 
-		if ( indOff > indLen )
-			indLen = indOff;
+		if ( numSpans > 0 && indOff + spans[numSpans-1] + 1 > indLen )
+			indLen = indOff + spans[numSpans-1] + 1;
 	}
 
 	/* We allocated the max, but cmpression gives us less. */
 	pdaTables->num_indices = indLen;
+	delete[] spans;
+	delete[] taken;
 	delete[] states;
 	
 
@@ -2094,20 +2210,20 @@ struct pda_tables *Compiler::makePdaTables( PdaGraph *pdaGraph )
 	 * Keys
 	 */
 	count = pdaGraph->stateList.length() * 2;;
-	pdaTables->keys = new int[count];
+	int *keys = new int[count];
 	pdaTables->num_keys = count;
 
 	count = 0;
 	for ( PdaStateList::Iter state = pdaGraph->stateList; state.lte(); state++ ) {
 		if ( state->transMap.length() == 0 ) {
-			pdaTables->keys[count+0] = 0;
-			pdaTables->keys[count+1] = 0;
+			keys[count+0] = 0;
+			keys[count+1] = 0;
 		}
 		else {
 			TransMap::Iter first = state->transMap.first();
 			TransMap::Iter last = state->transMap.last();
-			pdaTables->keys[count+0] = first->key;
-			pdaTables->keys[count+1] = last->key;
+			keys[count+0] = first->key;
+			keys[count+1] = last->key;
 		}
 		count += 2;
 	}
@@ -2116,23 +2232,23 @@ struct pda_tables *Compiler::makePdaTables( PdaGraph *pdaGraph )
 	 * Targs
 	 */
 	count = pdaGraph->actionSet.length();
-	pdaTables->targs = new unsigned int[count];
+	unsigned int *targs = new unsigned int[count];
 	pdaTables->num_targs = count;
 
 	count = 0;
 	for ( PdaActionSet::Iter asi = pdaGraph->actionSet; asi.lte(); asi++ )
-		pdaTables->targs[count++] = asi->key.targ;
+		targs[count++] = asi->key.targ;
 
 	/* 
 	 * ActInds
 	 */
 	count = pdaGraph->actionSet.length();
-	pdaTables->act_inds = new unsigned int[count];
+	unsigned int *actInds = new unsigned int[count];
 	pdaTables->num_act_inds = count;
 
 	count = pos = 0;
 	for ( PdaActionSet::Iter asi = pdaGraph->actionSet; asi.lte(); asi++ ) {
-		pdaTables->act_inds[count++] = pos;
+		actInds[count++] = pos;
 		pos += asi->key.actions.length() + 1;
 	}
 
@@ -2143,36 +2259,36 @@ struct pda_tables *Compiler::makePdaTables( PdaGraph *pdaGraph )
 	for ( PdaActionSet::Iter asi = pdaGraph->actionSet; asi.lte(); asi++ )
 		count += asi->key.actions.length() + 1;
 
-	pdaTables->actions = new unsigned int[count];
+	unsigned int *actions = new unsigned int[count];
 	pdaTables->num_actions = count;
 
 	count = 0;
 	for ( PdaActionSet::Iter asi = pdaGraph->actionSet; asi.lte(); asi++ ) {
 		for ( ActDataList::Iter ali = asi->key.actions; ali.lte(); ali++ )
-			pdaTables->actions[count++] = *ali;
+			actions[count++] = *ali;
 
-		pdaTables->actions[count++] = 0;
+		actions[count++] = 0;
 	}
 
 	/*
 	 * CommitLen
 	 */
 	count = pdaGraph->actionSet.length();
-	pdaTables->commit_len = new int[count];
+	int *commitLen = new int[count];
 	pdaTables->num_commit_len = count;
 
 	count = 0;
 	for ( PdaActionSet::Iter asi = pdaGraph->actionSet; asi.lte(); asi++ )
-		pdaTables->commit_len[count++] = asi->key.commitLen;
+		commitLen[count++] = asi->key.commitLen;
 	
 	/*
 	 * tokenRegionInds. Start at one so region index 0 is null (unset).
 	 */
 	count = 0;
 	pos = 1;
-	pdaTables->token_region_inds = new int[pdaTables->num_states];
+	int *tokenRegionInds = new int[pdaTables->num_states];
 	for ( PdaStateList::Iter state = pdaGraph->stateList; state.lte(); state++ ) {
-		pdaTables->token_region_inds[count++] = pos;
+		tokenRegionInds[count++] = pos;
 		pos += state->regions.length() + 1;
 	}
 
@@ -2186,17 +2302,17 @@ struct pda_tables *Compiler::makePdaTables( PdaGraph *pdaGraph )
 		count += state->regions.length() + 1;
 
 	pdaTables->num_region_items = count;
-	pdaTables->token_regions = new int[pdaTables->num_region_items];
+	int *tokenRegions = new int[pdaTables->num_region_items];
 
 	count = 0;
-	pdaTables->token_regions[count++] = 0;
+	tokenRegions[count++] = 0;
 	for ( PdaStateList::Iter state = pdaGraph->stateList; state.lte(); state++ ) {
 		for ( RegionVect::Iter reg = state->regions; reg.lte(); reg++ ) {
 			int id = ( *reg == EOF_REGION ) ? 0 : (*reg)->id + 1;
-			pdaTables->token_regions[count++] = id;
+			tokenRegions[count++] = id;
 		}
 
-		pdaTables->token_regions[count++] = 0;
+		tokenRegions[count++] = 0;
 	}
 
 	/*
@@ -2208,29 +2324,345 @@ struct pda_tables *Compiler::makePdaTables( PdaGraph *pdaGraph )
 		count += state->regions.length() + 1;
 
 	pdaTables->num_pre_region_items = count;
-	pdaTables->token_pre_regions = new int[pdaTables->num_pre_region_items];
+	int *tokenPreRegions = new int[pdaTables->num_pre_region_items];
 
 	count = 0;
-	pdaTables->token_pre_regions[count++] = 0;
+	tokenPreRegions[count++] = 0;
 	for ( PdaStateList::Iter state = pdaGraph->stateList; state.lte(); state++ ) {
 		for ( RegionVect::Iter reg = state->regions; reg.lte(); reg++ ) {
 			assert( state->preRegions.length() <= 1 );
 			if ( state->preRegions.length() == 0 || state->preRegions[0]->impl->wasEmpty )
-				pdaTables->token_pre_regions[count++] = -1;
+				tokenPreRegions[count++] = -1;
 			else 
-				pdaTables->token_pre_regions[count++] = state->preRegions[0]->id + 1;
+				tokenPreRegions[count++] = state->preRegions[0]->id + 1;
 		}
 
-		pdaTables->token_pre_regions[count++] = 0;
+		tokenPreRegions[count++] = 0;
 	}
 
+	pdaTables->indices = pdaTab( indices );
+	pdaTables->owners = pdaTab( owners );
+	pdaTables->keys = pdaTab( keys );
+	pdaTables->offsets = pdaTab( offsets );
+	pdaTables->targs = pdaTab( targs );
+	pdaTables->act_inds = pdaTab( actInds );
+	pdaTables->actions = pdaTab( actions );
+	pdaTables->commit_len = pdaTab( commitLen );
+	pdaTables->token_region_inds = pdaTab( tokenRegionInds );
+	pdaTables->token_regions = pdaTab( tokenRegions );
+	pdaTables->token_pre_regions = pdaTab( tokenPreRegions );
 
 	return pdaTables;
 }
 
+/* Mark the parse states reachable from a start state. Returns the number
+ * reached. */
+static long reachStates( struct pda_tables *t, long start,
+		int *stamp, int mark, long *stack )
+{
+	long count = 0, top = 0;
+	stamp[start] = mark;
+	stack[top++] = start;
+
+	while ( top > 0 ) {
+		long s = stack[--top];
+		count += 1;
+
+		long low = pda_tab_get( &t->keys, s<<1 );
+		long high = pda_tab_get( &t->keys, (s<<1)+1 );
+		long off = pda_tab_get( &t->offsets, s );
+		for ( long pos = off; pos <= off + high - low && pos < t->num_indices; pos++ ) {
+			if ( pda_tab_get( &t->owners, pos ) != s )
+				continue;
+
+			long ind = pda_tab_get( &t->indices, pos );
+			if ( ind < 0 )
+				continue;
+
+			long targ = pda_tab_get( &t->targs, ind );
+			if ( stamp[targ] != mark ) {
+				stamp[targ] = mark;
+				stack[top++] = targ;
+			}
+		}
+	}
+
+	return count;
+}
+
+/* Rebuild the parse tables with only the reached states and the action sets
+ * they use. States keep their relative order and are renumbered through
+ * stateMap. The index is packed again. */
+struct pda_tables *Compiler::makePrunedTables( struct pda_tables *t,
+		int *stateMap, long numReached )
+{
+	struct pda_tables *pt = new pda_tables;
+	memset( pt, 0, sizeof(pda_tables) );
+
+	long numSets = t->num_targs;
+	int *setMap = new int[numSets];
+	for ( long i = 0; i < numSets; i++ )
+		setMap[i] = -1;
+
+	/* Action sets used by kept states, and an upper bound on the index. */
+	long count = 0, numKept = 0, maxSpan = 0;
+	for ( long s = 0; s < t->num_states; s++ ) {
+		if ( stateMap[s] < 0 )
+			continue;
+
+		long low = pda_tab_get( &t->keys, s<<1 );
+		long high = pda_tab_get( &t->keys, (s<<1)+1 );
+		long off = pda_tab_get( &t->offsets, s );
+		count += high - low + 1;
+		if ( high - low + 1 > maxSpan )
+			maxSpan = high - low + 1;
+
+		for ( long pos = off; pos <= off + high - low && pos < t->num_indices; pos++ ) {
+			long ind = pda_tab_get( &t->owners, pos ) == s ?
+					pda_tab_get( &t->indices, pos ) : -1;
+			if ( ind >= 0 && setMap[ind] < 0 )
+				setMap[ind] = numKept++;
+		}
+	}
+
+	/*
+	 * Keys, offsets, indices and owners.
+	 */
+	int *keys = new int[numReached * 2];
+	unsigned int *offsets = new unsigned int[numReached];
+	int *indices = new int[count];
+	int *owners = new int[count];
+	for ( long i = 0; i < count; i++ ) {
+		indices[i] = -1;
+		owners[i] = -1;
+	}
+
+	long takenLen = count / TAKEN_BITS + 2;
+	unsigned long *taken = new unsigned long[takenLen];
+	memset( taken, 0, sizeof(unsigned long) * takenLen );
+	int *spans = new int[maxSpan];
+	int *sets = new int[maxSpan];
+
+	int indLen = 0;
+	for ( long s = 0; s < t->num_states; s++ ) {
+		long ns = stateMap[s];
+		if ( ns < 0 )
+			continue;
+
+		long low = pda_tab_get( &t->keys, s<<1 );
+		long high = pda_tab_get( &t->keys, (s<<1)+1 );
+		long off = pda_tab_get( &t->offsets, s );
+		keys[ns*2] = low;
+		keys[ns*2+1] = high;
+
+		int numSpans = 0;
+		for ( long pos = off; pos <= off + high - low && pos < t->num_indices; pos++ ) {
+			if ( pda_tab_get( &t->owners, pos ) == s ) {
+				spans[numSpans] = pos - off;
+				sets[numSpans++] = pda_tab_get( &t->indices, pos );
+			}
+		}
+
+		int indOff = findIndexOff( taken, spans, numSpans, indLen );
+		offsets[ns] = indOff;
+
+		for ( int i = 0; i < numSpans; i++ ) {
+			int pos = indOff + spans[i];
+			indices[pos] = sets[i] >= 0 ? setMap[sets[i]] : -1;
+			owners[pos] = ns;
+			taken[pos / TAKEN_BITS] |= 1UL << ( pos % TAKEN_BITS );
+		}
+
+		if ( numSpans > 0 && indOff + spans[numSpans-1] + 1 > indLen )
+			indLen = indOff + spans[numSpans-1] + 1;
+	}
+
+	delete[] spans;
+	delete[] sets;
+	delete[] taken;
+
+	/*
+	 * Targs, actInds, actions and commitLen of the kept action sets. The
+	 * actions of a set run up to the start of the next set.
+	 */
+	unsigned int *targs = new unsigned int[numKept];
+	unsigned int *actInds = new unsigned int[numKept];
+	int *commitLen = new int[numKept];
+	unsigned int *actions = new unsigned int[t->num_actions];
+	long numActions = 0;
+	for ( long i = 0; i < numSets; i++ ) {
+		long ns = setMap[i];
+		if ( ns < 0 )
+			continue;
+
+		targs[ns] = stateMap[pda_tab_get( &t->targs, i )];
+		commitLen[ns] = pda_tab_get( &t->commit_len, i );
+		actInds[ns] = numActions;
+
+		long from = pda_tab_get( &t->act_inds, i );
+		long to = i+1 < numSets ? pda_tab_get( &t->act_inds, i+1 ) : t->num_actions;
+		for ( long a = from; a < to; a++ )
+			actions[numActions++] = pda_tab_get( &t->actions, a );
+	}
+
+	/*
+	 * Token regions. Index zero stays the null list.
+	 */
+	int *tokenRegionInds = new int[numReached];
+	int *tokenRegions = new int[t->num_region_items];
+	int *tokenPreRegions = new int[t->num_pre_region_items];
+	long numRegionItems = 0;
+	tokenRegions[numRegionItems] = 0;
+	tokenPreRegions[numRegionItems++] = 0;
+	for ( long s = 0; s < t->num_states; s++ ) {
+		long ns = stateMap[s];
+		if ( ns < 0 )
+			continue;
+
+		tokenRegionInds[ns] = numRegionItems;
+
+		long from = pda_tab_get( &t->token_region_inds, s );
+		long to = s+1 < t->num_states ?
+				pda_tab_get( &t->token_region_inds, s+1 ) : t->num_region_items;
+		for ( long r = from; r < to; r++ ) {
+			tokenRegions[numRegionItems] = pda_tab_get( &t->token_regions, r );
+			tokenPreRegions[numRegionItems++] = pda_tab_get( &t->token_pre_regions, r );
+		}
+	}
+
+	pt->indices = pdaTab( indices );
+	pt->owners = pdaTab( owners );
+	pt->keys = pdaTab( keys );
+	pt->offsets = pdaTab( offsets );
+	pt->targs = pdaTab( targs );
+	pt->act_inds = pdaTab( actInds );
+	pt->actions = pdaTab( actions );
+	pt->commit_len = pdaTab( commitLen );
+	pt->token_region_inds = pdaTab( tokenRegionInds );
+	pt->token_regions = pdaTab( tokenRegions );
+	pt->token_pre_regions = pdaTab( tokenPreRegions );
+
+	pt->num_indices = indLen;
+	pt->num_keys = numReached * 2;
+	pt->num_states = numReached;
+	pt->num_targs = numKept;
+	pt->num_act_inds = numKept;
+	pt->num_actions = numActions;
+	pt->num_commit_len = numKept;
+	pt->num_region_items = numRegionItems;
+	pt->num_pre_region_items = numRegionItems;
+
+	delete[] setMap;
+	return pt;
+}
+
+/*
+ * Parsers made only for patterns and constructors run in the compiler, which
+ * is done with them by now. The generated program needs only the parse
+ * states its own parsers reach, and the scanner regions those states enter.
+ */
+void Compiler::pruneOutput()
+{
+	struct pda_tables *t = pdaTables;
+
+	int *stamp = new int[t->num_states];
+	bool *reached = new bool[t->num_states];
+	long *stack = new long[t->num_states];
+	for ( long s = 0; s < t->num_states; s++ ) {
+		stamp[s] = 0;
+		reached[s] = false;
+	}
+
+	for ( long p = 0; p < numRuntimeParsers; p++ ) {
+		long count = reachStates( t, runtimeData->start_states[p], stamp, p + 1, stack );
+		for ( long s = 0; s < t->num_states; s++ ) {
+			if ( stamp[s] == p + 1 )
+				reached[s] = true;
+		}
+
+		if ( printStatistics ) {
+			cerr << "parser " << langElIndex[runtimeData->parser_lel_ids[p]]->fullName <<
+					": " << count << " of " << t->num_states << " states" << endl;
+		}
+	}
+
+	int *stateMap = new int[t->num_states];
+	long numReached = 0;
+	for ( long s = 0; s < t->num_states; s++ )
+		stateMap[s] = reached[s] ? numReached++ : -1;
+
+	/* Regions entered from the kept states. */
+	bool *regionUsed = new bool[fsmTables->num_regions];
+	memset( regionUsed, 0, sizeof(bool) * fsmTables->num_regions );
+	for ( long s = 0; s < t->num_states; s++ ) {
+		if ( !reached[s] )
+			continue;
+
+		long from = pda_tab_get( &t->token_region_inds, s );
+		long to = s+1 < t->num_states ?
+				pda_tab_get( &t->token_region_inds, s+1 ) : t->num_region_items;
+		for ( long r = from; r < to; r++ ) {
+			long region = pda_tab_get( &t->token_regions, r );
+			long preRegion = pda_tab_get( &t->token_pre_regions, r );
+			if ( region > 0 && region < fsmTables->num_regions )
+				regionUsed[region] = true;
+			if ( preRegion > 0 && preRegion < fsmTables->num_regions )
+				regionUsed[preRegion] = true;
+		}
+	}
+
+	pdaTables = makePrunedTables( t, stateMap, numReached );
+	runtimeData->pda_tables = pdaTables;
+
+	for ( long p = 0; p < runtimeData->num_parsers; p++ ) {
+		runtimeData->start_states[p] = p < numRuntimeParsers ?
+				stateMap[runtimeData->start_states[p]] : -1;
+	}
+
+	int droppedStates = redFsm->pruneRegions( fsmTables, regionUsed );
+
+	if ( printStatistics ) {
+		cerr << "output parse states: " << numReached << " of " <<
+				t->num_states << endl;
+		cerr << "output scanner states: " << redFsm->stateList.length() <<
+				" of " << redFsm->stateList.length() + droppedStates << endl;
+	}
+
+	delete[] regionUsed;
+	delete[] stateMap;
+	delete[] stack;
+	delete[] reached;
+	delete[] stamp;
+}
+
 void Compiler::makeParser( LangElSet &parserEls )
 {
+	/* Graphviz output and branch point info need the graph itself. */
+	bool useCache = pdaCacheDir != 0 && !::generateGraphviz && !branchPointInfo;
+
+	unsigned long digest = 0;
+	if ( useCache ) {
+		phaseBegin( "pda cache" );
+		digest = pdaCacheDigest( parserEls );
+		bool hit = loadPdaCache( parserEls, digest );
+		phaseEnd( hit ? pdaTables->num_states : 0, "states" );
+
+		if ( hit ) {
+			if ( printStatistics )
+				cerr << "pda cache: hit " << std::hex << digest << std::dec << endl;
+			return;
+		}
+	}
+
+	phaseBegin( "pda graph" );
 	pdaGraph = makePdaGraph( parserEls );
+	phaseEnd( pdaGraph->stateList.length(), "states" );
+
+	phaseBegin( "pda tables" );
 	pdaTables = makePdaTables( pdaGraph );
+	phaseEnd( pdaTables->num_indices, "indices" );
+
+	if ( useCache && gblErrorCount == 0 )
+		storePdaCache( parserEls, digest );
 }
 
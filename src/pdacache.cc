@@ -0,0 +1,369 @@
+/*
+ * Copyright 2006-2018 Adrian Thurston <thurston@colm.net>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * On-disk cache of parse tables.
+ *
+ * Building the PDA graph and packing it into tables is the bulk of compile
+ * time for large grammars. The result depends only on the grammar as the
+ * table builder sees it: the language elements, their precedences and token
+ * regions, the productions and their elements, and the set of parsers. A
+ * digest is taken over exactly that, so edits to functions, reductions and
+ * other code leave it unchanged.
+ *
+ * A cache file holds the pda_tables arrays and the start state of each parser
+ * language element:
+ *
+ *   file:    "COLMPDA1" digest num_parsers (lel_id start_state)*
+ *            array*                                 (in pda_tables order)
+ *   array:   length value*
+ *
+ * All values are 32 bit, in host order. Files are written to a temporary name
+ * and renamed into place, so concurrent compiles never see a partial file.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <iostream>
+
+#include "compiler.h"
+#include "version.h"
+
+using std::endl;
+using std::cerr;
+
+#define PDA_CACHE_MAGIC "COLMPDA1"
+#define PDA_CACHE_MAGIC_LEN 8
+
+/* Part of the digest along with the version. Bump it whenever the table
+ * builder or the encoding of the tables changes, so that builds of the same
+ * version never load each other's tables. */
+#define PDA_CACHE_REVISION 2
+
+struct GrammarDigest
+{
+	GrammarDigest() : h(14695981039346656037UL) {}
+
+	void bytes( const char *data, long len )
+	{
+		/* FNV-1a. */
+		for ( long i = 0; i < len; i++ ) {
+			h ^= (unsigned char)data[i];
+			h *= 1099511628211UL;
+		}
+	}
+
+	void word( long w )
+		{ bytes( (const char*)&w, sizeof(w) ); }
+
+	void str( const char *s )
+		{ bytes( s, strlen(s) + 1 ); }
+
+	void region( TokenRegion *region )
+	{
+		if ( region == 0 )
+			word( -1 );
+		else {
+			word( region->id );
+			word( region->impl->wasEmpty );
+		}
+	}
+
+	unsigned long h;
+};
+
+unsigned long Compiler::pdaCacheDigest( LangElSet &parserEls )
+{
+	GrammarDigest d;
+	d.str( PDA_CACHE_MAGIC );
+	d.str( VERSION );
+	d.word( PDA_CACHE_REVISION );
+
+	d.word( nextLelId );
+	for ( long i = 0; i < nextLelId; i++ ) {
+		LangEl *lel = langElIndex[i];
+		if ( lel == 0 ) {
+			d.word( -1 );
+			continue;
+		}
+
+		d.word( lel->id );
+		d.word( lel->type );
+		d.word( lel->isEOF );
+		d.word( lel->isZero );
+		d.word( lel->reduceFirst );
+		d.word( lel->parseStop );
+		d.word( lel->noPreIgnore );
+		d.word( lel->noPostIgnore );
+		d.word( lel->predType );
+		d.word( lel->predValue );
+		d.word( lel->termDup != 0 ? lel->termDup->id : -1 );
+		d.word( lel->eofLel != 0 ? lel->eofLel->id : -1 );
+		d.word( lel->rootDef != 0 ? lel->rootDef->prodId : -1 );
+
+		if ( lel->tokenDef != 0 && lel->tokenDef->regionSet != 0 ) {
+			RegionSet *regionSet = lel->tokenDef->regionSet;
+			d.region( regionSet->tokenIgnore );
+			d.region( regionSet->tokenOnly );
+			d.region( regionSet->ignoreOnly );
+			d.region( regionSet->collectIgnore );
+		}
+		else {
+			d.word( -2 );
+		}
+
+		for ( LelProdList::Iter prod = lel->prodList; prod.lte(); prod++ )
+			d.word( prod->prodId );
+		d.word( -1 );
+	}
+
+	d.word( prodList.length() );
+	for ( ProdList::Iter prod = prodList; prod.lte(); prod++ ) {
+		d.word( prod->prodId );
+		d.word( prod->prodNum );
+		d.word( prod->prodName->id );
+		d.word( prod->prodCommit );
+		d.word( prod->predOf != 0 ? prod->predOf->id : -1 );
+		d.word( prod->prodElList->length() );
+		for ( ProdElList::Iter el = *prod->prodElList; el.lte(); el++ ) {
+			d.word( el->langEl->id );
+			d.word( el->priorVal );
+			d.word( el->commit );
+		}
+	}
+
+	/* The set is ordered by pointer. Use the ids instead, in id order. */
+	d.word( parserEls.length() );
+	for ( LelList::Iter lel = langEls; lel.lte(); lel++ ) {
+		if ( parserEls.find( lel ) )
+			d.word( lel->id );
+	}
+
+	return d.h;
+}
+
+static char *pdaCacheFn( unsigned long digest )
+{
+	char *fn = new char[strlen(pdaCacheDir) + 32];
+	sprintf( fn, "%s/%016lx.pda", pdaCacheDir, digest );
+	return fn;
+}
+
+static bool readInts( FILE *file, int *&data, int &length )
+{
+	int len;
+	if ( fread( &len, sizeof(int), 1, file ) != 1 || len < 0 )
+		return false;
+
+	/* Don't trust a corrupt length for the allocation. */
+	long pos = ftell( file );
+	if ( fseek( file, 0, SEEK_END ) != 0 )
+		return false;
+	long remaining = ftell( file ) - pos;
+	if ( fseek( file, pos, SEEK_SET ) != 0 || (long)len > remaining / (long)sizeof(int) )
+		return false;
+
+	data = new int[len];
+	length = len;
+	return fread( data, sizeof(int), len, file ) == (size_t)len;
+}
+
+static bool readUnsigned( FILE *file, unsigned int *&data, int &length )
+{
+	int *ints = 0;
+	bool ok = readInts( file, ints, length );
+	data = (unsigned int*)ints;
+	return ok;
+}
+
+static void writeInts( FILE *file, const void *data, int length )
+{
+	fwrite( &length, sizeof(int), 1, file );
+	fwrite( data, sizeof(int), length, file );
+}
+
+bool Compiler::loadPdaCache( LangElSet &parserEls, unsigned long digest )
+{
+	char *fn = pdaCacheFn( digest );
+	FILE *file = fopen( fn, "rb" );
+	delete[] fn;
+	if ( file == 0 )
+		return false;
+
+	char magic[PDA_CACHE_MAGIC_LEN];
+	unsigned long fileDigest;
+	int numParsers;
+	if ( fread( magic, 1, PDA_CACHE_MAGIC_LEN, file ) != PDA_CACHE_MAGIC_LEN ||
+			memcmp( magic, PDA_CACHE_MAGIC, PDA_CACHE_MAGIC_LEN ) != 0 ||
+			fread( &fileDigest, sizeof(fileDigest), 1, file ) != 1 ||
+			fileDigest != digest ||
+			fread( &numParsers, sizeof(int), 1, file ) != 1 ||
+			numParsers != parserEls.length() )
+	{
+		fclose( file );
+		return false;
+	}
+
+	int *startStates = new int[nextLelId];
+	for ( long i = 0; i < nextLelId; i++ )
+		startStates[i] = -1;
+
+	bool ok = true;
+	for ( int p = 0; ok && p < numParsers; p++ ) {
+		int ids[2];
+		ok = fread( ids, sizeof(int), 2, file ) == 2 &&
+				ids[0] >= 0 && ids[0] < nextLelId;
+		if ( ok )
+			startStates[ids[0]] = ids[1];
+	}
+
+	struct pda_tables *tables = new pda_tables;
+	memset( tables, 0, sizeof(pda_tables) );
+	int numOffsets = 0, numTokenRegionInds = 0;
+
+	int *indices = 0, *owners = 0, *keys = 0, *commitLen = 0;
+	int *tokenRegionInds = 0, *tokenRegions = 0, *tokenPreRegions = 0;
+	unsigned int *offsets = 0, *targs = 0, *actInds = 0, *actions = 0;
+
+	ok = ok &&
+		readInts( file, indices, tables->num_indices ) &&
+		readInts( file, owners, tables->num_indices ) &&
+		readInts( file, keys, tables->num_keys ) &&
+		readUnsigned( file, offsets, numOffsets ) &&
+		readUnsigned( file, targs, tables->num_targs ) &&
+		readUnsigned( file, actInds, tables->num_act_inds ) &&
+		readUnsigned( file, actions, tables->num_actions ) &&
+		readInts( file, commitLen, tables->num_commit_len ) &&
+		readInts( file, tokenRegionInds, numTokenRegionInds ) &&
+		readInts( file, tokenRegions, tables->num_region_items ) &&
+		readInts( file, tokenPreRegions, tables->num_pre_region_items );
+
+	fclose( file );
+
+	tables->indices = pdaTab( indices );
+	tables->owners = pdaTab( owners );
+	tables->keys = pdaTab( keys );
+	tables->offsets = pdaTab( offsets );
+	tables->targs = pdaTab( targs );
+	tables->act_inds = pdaTab( actInds );
+	tables->actions = pdaTab( actions );
+	tables->commit_len = pdaTab( commitLen );
+	tables->token_region_inds = pdaTab( tokenRegionInds );
+	tables->token_regions = pdaTab( tokenRegions );
+	tables->token_pre_regions = pdaTab( tokenPreRegions );
+
+	tables->num_states = numOffsets;
+	ok = ok && numTokenRegionInds == numOffsets;
+
+	/* Every parser must have come back with a start state. */
+	for ( LangElSet::Iter pe = parserEls; ok && pe.lte(); pe++ ) {
+		if ( startStates[(*pe)->id] < 0 )
+			ok = false;
+	}
+
+	if ( !ok ) {
+		/* Corrupt or short file. Arrays not reached are still null. */
+		delete[] indices;
+		delete[] owners;
+		delete[] keys;
+		delete[] offsets;
+		delete[] targs;
+		delete[] actInds;
+		delete[] actions;
+		delete[] commitLen;
+		delete[] tokenRegionInds;
+		delete[] tokenRegions;
+		delete[] tokenPreRegions;
+		delete tables;
+		delete[] startStates;
+		return false;
+	}
+
+	/* There is no graph behind cached tables. Parsers only need the number
+	 * of their start state. */
+	for ( LangElSet::Iter pe = parserEls; pe.lte(); pe++ ) {
+		(*pe)->startState = new PdaState;
+		(*pe)->startState->stateNum = startStates[(*pe)->id];
+	}
+
+	delete[] startStates;
+	pdaTables = tables;
+	return true;
+}
+
+void Compiler::storePdaCache( LangElSet &parserEls, unsigned long digest )
+{
+	char *fn = pdaCacheFn( digest );
+	char *tmpFn = new char[strlen(fn) + 32];
+	sprintf( tmpFn, "%s.%ld", fn, (long)getpid() );
+
+	FILE *file = fopen( tmpFn, "wb" );
+	if ( file == 0 ) {
+		if ( printStatistics )
+			cerr << "pda cache: could not write " << tmpFn << endl;
+		delete[] tmpFn;
+		delete[] fn;
+		return;
+	}
+
+	int numParsers = parserEls.length();
+	fwrite( PDA_CACHE_MAGIC, 1, PDA_CACHE_MAGIC_LEN, file );
+	fwrite( &digest, sizeof(digest), 1, file );
+	fwrite( &numParsers, sizeof(int), 1, file );
+	for ( LangElSet::Iter pe = parserEls; pe.lte(); pe++ ) {
+		int ids[2] = { (int)(*pe)->id, (*pe)->startState->stateNum };
+		fwrite( ids, sizeof(int), 2, file );
+	}
+
+	/* Tables the compiler built are all 32 bit. */
+	struct pda_tables *t = pdaTables;
+	writeInts( file, t->indices.data, t->num_indices );
+	writeInts( file, t->owners.data, t->num_indices );
+	writeInts( file, t->keys.data, t->num_keys );
+	writeInts( file, t->offsets.data, t->num_states );
+	writeInts( file, t->targs.data, t->num_targs );
+	writeInts( file, t->act_inds.data, t->num_act_inds );
+	writeInts( file, t->actions.data, t->num_actions );
+	writeInts( file, t->commit_len.data, t->num_commit_len );
+	writeInts( file, t->token_region_inds.data, t->num_states );
+	writeInts( file, t->token_regions.data, t->num_region_items );
+	writeInts( file, t->token_pre_regions.data, t->num_pre_region_items );
+
+	bool ok = !ferror( file );
+	ok = fclose( file ) == 0 && ok;
+
+	if ( ok && rename( tmpFn, fn ) == 0 ) {
+		if ( printStatistics )
+			cerr << "pda cache: stored " << fn << endl;
+	}
+	else {
+		unlink( tmpFn );
+		if ( printStatistics )
+			cerr << "pda cache: could not write " << fn << endl;
+	}
+
+	delete[] tmpFn;
+	delete[] fn;
+}
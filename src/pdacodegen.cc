@@ -21,6 +21,7 @@
  */
 
 #include <string.h>
+#include <limits.h>
 
 #include <iostream>
 #include <iomanip>
@@ -67,7 +68,27 @@ void PdaCodeGen::defineRuntime()
 		"\n";
 }
 
-void PdaCodeGen::writeRuntimeData( colm_sections *runtimeData, struct pda_tables *pdaTables )
+/* With split output the runtime data refers to the scanner, the parse tables
+ * and the bytecode in other files. */
+void PdaCodeGen::declareShared()
+{
+	out <<
+		"extern " << shared() << "struct fsm_tables " << sharedName( "fsmTables_start" ) << ";\n" <<
+		shared() << "void " << sharedName( "fsm_execute" ) <<
+				"( struct pda_run *pdaRun, struct input_impl *inputStream );\n" <<
+		shared() << "void " << sharedName( "sendNamedLangEl" ) << "( struct colm_program *prg, tree_t **tree,\n"
+		"		struct pda_run *pda_run, struct input_impl *input );\n" <<
+		shared() << "void " << sharedName( "initBindings" ) << "( struct pda_run *pdaRun );\n" <<
+		shared() << "void " << sharedName( "popBinding" ) << "( struct pda_run *pdaRun, parse_tree_t *tree );\n"
+		"\n"
+		"extern " << shared() << "struct pda_tables " << sharedName( "pid_0_pdaTables" ) << ";\n"
+		"\n"
+		"extern " << shared() << "code_t " << rootCode() << "[];\n"
+		"extern " << shared() << "struct frame_info " << frameInfo() << "[];\n"
+		"\n";
+}
+
+void PdaCodeGen::writeCodeData( colm_sections *runtimeData )
 {
 	/*
 	 * Blocks of code in frames.
@@ -123,6 +144,69 @@ void PdaCodeGen::writeRuntimeData( colm_sections *runtimeData, struct pda_tables
 		}
 	}
 
+	/* 
+	 * Init code.
+	 */
+	out << shared() << "code_t " << rootCode() << "[] = {\n\t";
+	code_t *block = runtimeData->root_code ;
+	for ( int j = 0; j < runtimeData->root_code_len; j++ ) {
+		out << (unsigned int) block[j];
+
+		if ( j < runtimeData->root_code_len-1 ) {
+			out << ", ";
+			if ( (j+1) % 8 == 0 )
+				out << "\n\t";
+		}
+	}
+	out << "\n};\n\n";
+
+	/*
+	 * frameInfo
+	 */
+	out << shared() << "struct frame_info " << frameInfo() << "[] = {\n";
+	for ( int i = 0; i < runtimeData->num_frames; i++ ) {
+		out << "\t{ ";
+
+		/* The Name. */
+		if ( runtimeData->frame_info[i].name )
+			out << "\"" << runtimeData->frame_info[i].name << "\", ";
+		else 
+			out << "\"\", ";
+
+		if ( runtimeData->frame_info[i].codeLenWV > 0 )
+			out << "code_" << i << "_wv, ";
+		else
+			out << "0, ";
+		out << runtimeData->frame_info[i].codeLenWV << ", ";
+
+		if ( runtimeData->frame_info[i].codeLenWC > 0 )
+			out << "code_" << i << "_wc, ";
+		else
+			out << "0, ";
+		out << runtimeData->frame_info[i].codeLenWC << ", ";
+
+		/* locals. */
+		if ( runtimeData->frame_info[i].locals_len > 0 )
+			out << "locals_" << i << ", ";
+		else
+			out << "0, ";
+
+		out << runtimeData->frame_info[i].locals_len << ", ";
+
+		out <<
+			runtimeData->frame_info[i].arg_size << ", " <<
+			runtimeData->frame_info[i].frame_size;
+
+		out << " }";
+
+		if ( i < runtimeData->num_frames-1 )
+			out << ",\n";
+	}
+	out << "\n};\n\n";
+}
+
+void PdaCodeGen::writeRuntimeData( colm_sections *runtimeData, struct pda_tables *pdaTables )
+{
 	/*
 	 * Blocks in production info.
 	 */
@@ -144,22 +228,6 @@ void PdaCodeGen::writeRuntimeData( colm_sections *runtimeData, struct pda_tables
 		}
 	}
 
-	/* 
-	 * Init code.
-	 */
-	out << "static code_t " << rootCode() << "[] = {\n\t";
-	code_t *block = runtimeData->root_code ;
-	for ( int j = 0; j < runtimeData->root_code_len; j++ ) {
-		out << (unsigned int) block[j];
-
-		if ( j < runtimeData->root_code_len-1 ) {
-			out << ", ";
-			if ( (j+1) % 8 == 0 )
-				out << "\n\t";
-		}
-	}
-	out << "\n};\n\n";
-
 	/*
 	 * lelInfo
 	 */
@@ -232,51 +300,6 @@ void PdaCodeGen::writeRuntimeData( colm_sections *runtimeData, struct pda_tables
 	}
 	out << "\n};\n\n";
 
-	/*
-	 * frameInfo
-	 */
-	out << "static struct frame_info " << frameInfo() << "[] = {\n";
-	for ( int i = 0; i < runtimeData->num_frames; i++ ) {
-		out << "\t{ ";
-
-		/* The Name. */
-		if ( runtimeData->frame_info[i].name )
-			out << "\"" << runtimeData->frame_info[i].name << "\", ";
-		else 
-			out << "\"\", ";
-
-		if ( runtimeData->frame_info[i].codeLenWV > 0 )
-			out << "code_" << i << "_wv, ";
-		else
-			out << "0, ";
-		out << runtimeData->frame_info[i].codeLenWV << ", ";
-
-		if ( runtimeData->frame_info[i].codeLenWC > 0 )
-			out << "code_" << i << "_wc, ";
-		else
-			out << "0, ";
-		out << runtimeData->frame_info[i].codeLenWC << ", ";
-
-		/* locals. */
-		if ( runtimeData->frame_info[i].locals_len > 0 )
-			out << "locals_" << i << ", ";
-		else
-			out << "0, ";
-
-		out << runtimeData->frame_info[i].locals_len << ", ";
-
-		out <<
-			runtimeData->frame_info[i].arg_size << ", " <<
-			runtimeData->frame_info[i].frame_size;
-
-		out << " }";
-
-		if ( i < runtimeData->num_frames-1 )
-			out << ",\n";
-	}
-	out << "\n};\n\n";
-
-
 	/*
 	 * prodInfo
 	 */
@@ -441,6 +464,21 @@ void PdaCodeGen::writeRuntimeData( colm_sections *runtimeData, struct pda_tables
 
 	out << "};\n\n";
 
+	long containLen = ( runtimeData->num_lang_els - runtimeData->first_non_term_id ) *
+			runtimeData->contain_width;
+	out << "static unsigned char containSets[] = {\n\t";
+	for ( long i = 0; i < containLen; i++ ) {
+		out << (int)runtimeData->contain_sets[i];
+		if ( i < containLen-1 ) {
+			out << ", ";
+			if ( (i+1) % 16 == 0 )
+				out << "\n\t";
+		}
+	}
+	if ( containLen == 0 )
+		out << "0";
+	out << "\n};\n\n";
+
 	out <<
 		"tree_t **" << objectName << "_host_call( program_t *prg, long code, tree_t **sp );\n"
 		"void " << objectName << "_commit_reduce_forward( program_t *prg, tree_t **root,\n"
@@ -520,8 +558,11 @@ void PdaCodeGen::writeRuntimeData( colm_sections *runtimeData, struct pda_tables
 		"	captureAttr,\n"
 		"	" << runtimeData->num_captured_attr << ",\n"
 		"\n"
-		"	&fsmTables_start,\n"
-		"	&pid_0_pdaTables,\n"
+		"	containSets,\n"
+		"	" << runtimeData->contain_width << ",\n"
+		"\n"
+		"	&" << sharedName( "fsmTables_start" ) << ",\n"
+		"	&" << sharedName( "pid_0_pdaTables" ) << ",\n"
 		"	startStates, eofLelIds, parserLelIds, " << runtimeData->num_parsers << ",\n"
 		"\n"
 		"	" << runtimeData->global_size << ",\n"
@@ -539,10 +580,10 @@ void PdaCodeGen::writeRuntimeData( colm_sections *runtimeData, struct pda_tables
 		"	" << runtimeData->struct_inbuilt_id << ",\n"
 		"	" << runtimeData->struct_inbuilt_id << ",\n"
 		"	" << runtimeData->struct_stream_id << ",\n"
-		"	&fsm_execute,\n"
-		"	&sendNamedLangEl,\n"
-		"	&initBindings,\n"
-		"	&popBinding,\n"
+		"	&" << sharedName( "fsm_execute" ) << ",\n"
+		"	&" << sharedName( "sendNamedLangEl" ) << ",\n"
+		"	&" << sharedName( "initBindings" ) << ",\n"
+		"	&" << sharedName( "popBinding" ) << ",\n"
 		"	&" << objectName << "_host_call,\n"
 		"	&" << objectName << "_commit_reduce_forward,\n" 
 		"	&" << objectName << "_commit_union_sz,\n"
@@ -554,111 +595,78 @@ void PdaCodeGen::writeRuntimeData( colm_sections *runtimeData, struct pda_tables
 		"\n";
 }
 
-void PdaCodeGen::writeParserData( long id, struct pda_tables *tables )
+static int tableType( struct pda_tab *tab, int length )
 {
-	String prefix = "pid_" + String(0, "%ld", id) + "_";
-
-	out << "static int " << prefix << indices() << "[] = {\n\t";
-	for ( int i = 0; i < tables->num_indices; i++ ) {
-		out << tables->indices[i];
-
-		if ( i < tables->num_indices-1 ) {
-			out << ", ";
-			if ( (i+1) % 8 == 0 )
-				out << "\n\t";
-		}
-	}
-	out << "\n};\n\n";
-
-	out << "static int " << prefix << owners() << "[] = {\n\t";
-	for ( int i = 0; i < tables->num_indices; i++ ) {
-		out << tables->owners[i];
-
-		if ( i < tables->num_indices-1 ) {
-			out << ", ";
-			if ( (i+1) % 8 == 0 )
-				out << "\n\t";
-		}
-	}
-	out << "\n};\n\n";
-
-	out << "static int " << prefix << keys() << "[] = {\n\t";
-	for ( int i = 0; i < tables->num_keys; i++ ) {
-		out << tables->keys[i];
-
-		if ( i < tables->num_keys-1 ) {
-			out << ", ";
-			if ( (i+1) % 8 == 0 )
-				out << "\n\t";
-		}
-	}
-	out << "\n};\n\n";
-
-	out << "static unsigned int " << prefix << offsets() << "[] = {\n\t";
-	for ( int i = 0; i < tables->num_states; i++ ) {
-		out << tables->offsets[i];
-
-		if ( i < tables->num_states-1 ) {
-			out << ", ";
-			if ( (i+1) % 8 == 0 )
-				out << "\n\t";
-		}
-	}
-	out << "\n};\n\n";
-
-	out << "static unsigned int " << prefix << targs() << "[] = {\n\t";
-	for ( int i = 0; i < tables->num_targs; i++ ) {
-		out << tables->targs[i];
-
-		if ( i < tables->num_targs-1 ) {
-			out << ", ";
-			if ( (i+1) % 8 == 0 )
-				out << "\n\t";
-		}
-	}
-	out << "\n};\n\n";
-
-	out << "static unsigned int " << prefix << actInds() << "[] = {\n\t";
-	for ( int i = 0; i < tables->num_act_inds; i++ ) {
-		out << tables->act_inds[i];
-
-		if ( i < tables->num_act_inds-1 ) {
-			out << ", ";
-			if ( (i+1) % 8 == 0 )
-				out << "\n\t";
-		}
-	}
-	out << "\n};\n\n";
-
-	out << "static unsigned int " << prefix << actions() << "[] = {\n\t";
-	for ( int i = 0; i < tables->num_actions; i++ ) {
-		out << tables->actions[i];
+	long min = 0, max = 0;
+	for ( int i = 0; i < length; i++ ) {
+		long v = pda_tab_get( tab, i );
+		if ( v < min )
+			min = v;
+		if ( v > max )
+			max = v;
+	}
+
+	if ( min >= 0 ) {
+		if ( max <= UCHAR_MAX )
+			return PDA_TAB_U8;
+		else if ( max <= USHRT_MAX )
+			return PDA_TAB_U16;
+		return PDA_TAB_U32;
+	}
+
+	if ( min >= SCHAR_MIN && max <= SCHAR_MAX )
+		return PDA_TAB_S8;
+	else if ( min >= SHRT_MIN && max <= SHRT_MAX )
+		return PDA_TAB_S16;
+	return PDA_TAB_S32;
+}
 
-		if ( i < tables->num_actions-1 ) {
-			out << ", ";
-			if ( (i+1) % 8 == 0 )
-				out << "\n\t";
-		}
-	}
-	out << "\n};\n\n";
+static const char *tableTypeName( int type )
+{
+	switch ( type ) {
+		case PDA_TAB_S8:  return "signed char";
+		case PDA_TAB_U8:  return "unsigned char";
+		case PDA_TAB_S16: return "short";
+		case PDA_TAB_U16: return "unsigned short";
+		case PDA_TAB_S32: return "int";
+	}
+	return "unsigned int";
+}
 
-	out << "static int " << prefix << commitLen() << "[] = {\n\t";
-	for ( int i = 0; i < tables->num_commit_len; i++ ) {
-		out << tables->commit_len[i];
+static const char *tableTypeId( int type )
+{
+	switch ( type ) {
+		case PDA_TAB_S8:  return "PDA_TAB_S8";
+		case PDA_TAB_U8:  return "PDA_TAB_U8";
+		case PDA_TAB_S16: return "PDA_TAB_S16";
+		case PDA_TAB_U16: return "PDA_TAB_U16";
+		case PDA_TAB_S32: return "PDA_TAB_S32";
+	}
+	return "PDA_TAB_U32";
+}
 
-		if ( i < tables->num_commit_len-1 ) {
-			out << ", ";
-			if ( (i+1) % 8 == 0 )
-				out << "\n\t";
+/* Write a parse table array in the smallest type that holds its values. An
+ * array identical to one already written is shared rather than written again.
+ * Returns the initializer of the view. */
+String PdaCodeGen::writeTable( const String &name, struct pda_tab *tab, int length )
+{
+	int type = tableType( tab, length );
+
+	for ( Vector<EmittedTable>::Iter et = emittedTables; et.lte(); et++ ) {
+		if ( et->type == type && et->length == length ) {
+			int i = 0;
+			while ( i < length && pda_tab_get( et->tab, i ) == pda_tab_get( tab, i ) )
+				i += 1;
+			if ( i == length )
+				return String( 0, "{ %s, %s }", et->name.data, tableTypeId( type ) );
 		}
 	}
-	out << "\n};\n\n";
 
-	out << "static int " << prefix << tokenRegionInds() << "[] = {\n\t";
-	for ( int i = 0; i < tables->num_states; i++ ) {
-		out << tables->token_region_inds[i];
+	out << "static const " << tableTypeName( type ) << " " << name << "[] = {\n\t";
+	for ( int i = 0; i < length; i++ ) {
+		out << pda_tab_get( tab, i );
 
-		if ( i < tables->num_states-1 ) {
+		if ( i < length-1 ) {
 			out << ", ";
 			if ( (i+1) % 8 == 0 )
 				out << "\n\t";
@@ -666,45 +674,52 @@ void PdaCodeGen::writeParserData( long id, struct pda_tables *tables )
 	}
 	out << "\n};\n\n";
 
-	out << "static int " << prefix << tokenRegions() << "[] = {\n\t";
-	for ( int i = 0; i < tables->num_region_items; i++ ) {
-		out << tables->token_regions[i];
-
-		if ( i < tables->num_region_items-1 ) {
-			out << ", ";
-			if ( (i+1) % 8 == 0 )
-				out << "\n\t";
-		}
-	}
-	out << "\n};\n\n";
+	emittedTables.append( EmittedTable( name, type, tab, length ) );
+	return String( 0, "{ %s, %s }", name.data, tableTypeId( type ) );
+}
 
-	out << "static int " << prefix << tokenPreRegions() << "[] = {\n\t";
-	for ( int i = 0; i < tables->num_pre_region_items; i++ ) {
-		out << tables->token_pre_regions[i];
+void PdaCodeGen::writeParserData( long id, struct pda_tables *tables )
+{
+	String prefix = "pid_" + String(0, "%ld", id) + "_";
 
-		if ( i < tables->num_pre_region_items-1 ) {
-			out << ", ";
-			if ( (i+1) % 8 == 0 )
-				out << "\n\t";
-		}
-	}
-	out << "\n};\n\n";
+	String indicesView = writeTable( prefix + indices(),
+			&tables->indices, tables->num_indices );
+	String ownersView = writeTable( prefix + owners(),
+			&tables->owners, tables->num_indices );
+	String keysView = writeTable( prefix + keys(),
+			&tables->keys, tables->num_keys );
+	String offsetsView = writeTable( prefix + offsets(),
+			&tables->offsets, tables->num_states );
+	String targsView = writeTable( prefix + targs(),
+			&tables->targs, tables->num_targs );
+	String actIndsView = writeTable( prefix + actInds(),
+			&tables->act_inds, tables->num_act_inds );
+	String actionsView = writeTable( prefix + actions(),
+			&tables->actions, tables->num_actions );
+	String commitLenView = writeTable( prefix + commitLen(),
+			&tables->commit_len, tables->num_commit_len );
+	String tokenRegionIndsView = writeTable( prefix + tokenRegionInds(),
+			&tables->token_region_inds, tables->num_states );
+	String tokenRegionsView = writeTable( prefix + tokenRegions(),
+			&tables->token_regions, tables->num_region_items );
+	String tokenPreRegionsView = writeTable( prefix + tokenPreRegions(),
+			&tables->token_pre_regions, tables->num_pre_region_items );
 
 	out << 
-		"static struct pda_tables " << prefix << "pdaTables =\n"
+		shared() << "struct pda_tables " << sharedName( prefix + "pdaTables" ) << " =\n"
 		"{\n"
-		"	" << prefix << indices() << ",\n"
-		"	" << prefix << owners() << ",\n"
-		"	" << prefix << keys() << ",\n"
-		"	" << prefix << offsets() << ",\n"
-		"	" << prefix << targs() << ",\n"
-		"	" << prefix << actInds() << ",\n"
-		"	" << prefix << actions() << ",\n"
-		"	" << prefix << commitLen() << ",\n"
-
-		"	" << prefix << tokenRegionInds() << ",\n"
-		"	" << prefix << tokenRegions() << ",\n"
-		"	" << prefix << tokenPreRegions() << ",\n"
+		"	" << indicesView << ",\n"
+		"	" << ownersView << ",\n"
+		"	" << keysView << ",\n"
+		"	" << offsetsView << ",\n"
+		"	" << targsView << ",\n"
+		"	" << actIndsView << ",\n"
+		"	" << actionsView << ",\n"
+		"	" << commitLenView << ",\n"
+
+		"	" << tokenRegionIndsView << ",\n"
+		"	" << tokenRegionsView << ",\n"
+		"	" << tokenPreRegionsView << ",\n"
 		"\n"
 		"	" << tables->num_indices << ",\n"
 		"	" << tables->num_keys << ",\n"
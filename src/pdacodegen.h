@@ -25,6 +25,18 @@
 
 struct Compiler;
 
+/* A parse table array already written. */
+struct EmittedTable
+{
+	EmittedTable( const String &name, int type, struct pda_tab *tab, int length )
+		: name(name), type(type), tab(tab), length(length) {}
+
+	String name;
+	int type;
+	struct pda_tab *tab;
+	int length;
+};
+
 struct PdaCodeGen
 {
 	PdaCodeGen( ostream &out )
@@ -45,11 +57,22 @@ struct PdaCodeGen
 	void writeRhsLocate( Production *prod );
 
 	void defineRuntime();
+	void declareShared();
+	void writeCodeData( colm_sections *runtimeData );
 	void writeRuntimeData( colm_sections *runtimeData, struct pda_tables *pdaTables );
 	void writeParserData( long id, struct pda_tables *tables );
+	String writeTable( const String &name, struct pda_tab *tab, int length );
 
 	String PARSER() { return "parser_"; }
 
+	/* Storage class and names of symbols shared between the files of split
+	 * output. They are hidden and carry the object name, so the split outputs
+	 * of several programs can be linked into one binary. */
+	String shared()
+		{ return splitOutput ? "__attribute__((visibility(\"hidden\"))) " : "static "; }
+	String sharedName( const String &name )
+		{ return splitOutput ? String( objectName ) + "_" + name : name; }
+
 	String startState() { return PARSER() + "startState"; }
 	String indices() { return PARSER() + "indices"; }
 	String owners() { return PARSER() + "owners"; }
@@ -71,8 +94,8 @@ struct PdaCodeGen
 	String tokenPreRegions() { return PARSER() + "tokenPreRegions"; }
 	String prodCodeBlocks() { return PARSER() + "prodCodeBlocks"; }
 	String prodCodeBlockLens() { return PARSER() + "prodCodeBlockLens"; }
-	String rootCode() { return PARSER() + "rootCode"; }
-	String frameInfo() { return PARSER() + "frameInfo"; }
+	String rootCode() { return sharedName( PARSER() + "rootCode" ); }
+	String frameInfo() { return sharedName( PARSER() + "frameInfo" ); }
 	String functionInfo() { return PARSER() + "functionInfo"; }
 	String objFieldInfo() { return PARSER() + "objFieldInfo"; }
 	String patReplInfo() { return PARSER() + "patReplInfo"; }
@@ -93,6 +116,7 @@ struct PdaCodeGen
 	void writeDotFile( );
 
 	ostream &out;
+	Vector<EmittedTable> emittedTables;
 };
 
 extern "C"
@@ -24,6 +24,7 @@
 #define _COLM_PDAGRAPH_H
 
 #include <assert.h>
+#include <string.h>
 
 #include <avltree.h>
 #include <bstmap.h>
@@ -110,6 +111,46 @@ typedef BstSet< DefSet, CmpDefSet > DefSetSet;
 typedef Vector< Production* > DefVect;
 typedef BstSet< long, CmpOrd<long> > AlphSet;
 
+/* Dense set of language element ids. Used for the follow sets computed while
+ * ordering actions, where the sets are unioned far more often than read. */
+struct LelBitSet
+{
+	LelBitSet() : words(0), numWords(0) {}
+	~LelBitSet() { delete[] words; }
+
+	void setSize( long numIds )
+	{
+		delete[] words;
+		numWords = ( numIds + WORD_BITS - 1 ) / WORD_BITS;
+		words = new unsigned long[numWords];
+		clear();
+	}
+
+	void clear()
+		{ memset( words, 0, sizeof(unsigned long) * numWords ); }
+
+	void insert( long id )
+		{ words[id / WORD_BITS] |= 1UL << ( id % WORD_BITS ); }
+
+	bool find( long id ) const
+		{ return ( words[id / WORD_BITS] >> ( id % WORD_BITS ) ) & 1; }
+
+	void insert( const LelBitSet &other )
+	{
+		for ( long i = 0; i < numWords; i++ )
+			words[i] |= other.words[i];
+	}
+
+	static const long WORD_BITS = sizeof(unsigned long) * 8;
+
+	unsigned long *words;
+	long numWords;
+
+private:
+	LelBitSet( const LelBitSet & );
+	LelBitSet &operator=( const LelBitSet & );
+};
+
 struct ExpandToEl
 {
 	ExpandToEl( PdaState *state, int prodId )
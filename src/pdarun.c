@@ -89,6 +89,21 @@ static void clear_fsm_run( program_t *prg, struct pda_run *pda_run )
 	}
 }
 
+/* Get a buffer for consumed text, reusing one released by
+ * colm_reset_program if the length permits. */
+static struct run_buf *consume_run_buf( program_t *prg, int sz )
+{
+	struct run_buf *rb = prg->free_run_buf;
+	if ( rb == 0 || sz > FSM_BUFSIZE )
+		return new_run_buf( sz );
+
+	prg->free_run_buf = rb->next;
+	rb->length = 0;
+	rb->offset = 0;
+	rb->next = rb->prev = 0;
+	return rb;
+}
+
 void colm_increment_steps( struct pda_run *pda_run )
 {
 	pda_run->steps += 1;
@@ -107,7 +122,7 @@ head_t *colm_stream_pull( program_t *prg, tree_t **sp, struct pda_run *pda_run,
 	if ( pda_run != 0 ) {
 		struct run_buf *run_buf = pda_run->consume_buf;
 		if ( length > ( FSM_BUFSIZE - run_buf->length ) ) {
-			run_buf = new_run_buf( 0 );
+			run_buf = consume_run_buf( prg, 0 );
 			run_buf->next = pda_run->consume_buf;
 			pda_run->consume_buf = run_buf;
 		}
@@ -281,7 +296,7 @@ static void set_region( struct pda_run *pda_run, int empty_ignore, parse_tree_t
 	if ( empty_ignore ) {
 		/* Recording the next region. */
 		tree->retry_region = pda_run->next_region_ind;
-		if ( pda_run->pda_tables->token_regions[tree->retry_region+1] != 0 )
+		if ( pda_tab_get( &pda_run->pda_tables->token_regions, tree->retry_region+1 ) != 0 )
 			pda_run->num_retry += 1;
 	}
 }
@@ -707,7 +722,7 @@ static head_t *extract_match( program_t *prg, tree_t **sp,
 
 	struct run_buf *run_buf = pda_run->consume_buf;
 	if ( run_buf == 0 || length > ( FSM_BUFSIZE - run_buf->length ) ) {
-		run_buf = new_run_buf( length );
+		run_buf = consume_run_buf( prg, length );
 		run_buf->next = pda_run->consume_buf;
 		pda_run->consume_buf = run_buf;
 	}
@@ -764,7 +779,7 @@ static head_t *extract_no_l( program_t *prg, tree_t **sp,
 
 	struct run_buf *run_buf = pda_run->consume_buf;
 	if ( run_buf == 0 || length > ( FSM_BUFSIZE - run_buf->length ) ) {
-		run_buf = new_run_buf( length );
+		run_buf = consume_run_buf( prg, length );
 		run_buf->next = pda_run->consume_buf;
 		pda_run->consume_buf = run_buf;
 	}
@@ -820,7 +835,7 @@ static head_t *peek_match( program_t *prg, struct pda_run *pda_run, struct input
 
 	struct run_buf *run_buf = pda_run->consume_buf;
 	if ( run_buf == 0 || length > ( FSM_BUFSIZE - run_buf->length ) ) {
-		run_buf = new_run_buf( 0 );
+		run_buf = consume_run_buf( prg, 0 );
 		run_buf->next = pda_run->consume_buf;
 		pda_run->consume_buf = run_buf;
 	}
@@ -967,12 +982,14 @@ static void send_collect_ignore( program_t *prg, tree_t **sp,
 /* Offset can be used to look at the next nextRegionInd. */
 static int get_next_region( struct pda_run *pda_run, int offset )
 {
-	return pda_run->pda_tables->token_regions[pda_run->next_region_ind+offset];
+	return pda_tab_get( &pda_run->pda_tables->token_regions,
+			pda_run->next_region_ind+offset );
 }
 
 static int get_next_pre_region( struct pda_run *pda_run )
 {
-	return pda_run->pda_tables->token_pre_regions[pda_run->next_region_ind];
+	return pda_tab_get( &pda_run->pda_tables->token_pre_regions,
+			pda_run->next_region_ind );
 }
 
 static void send_eof( program_t *prg, tree_t **sp, struct pda_run *pda_run,
@@ -1309,7 +1326,8 @@ void colm_pda_init( program_t *prg, struct pda_run *pda_run, struct pda_tables *
 	pda_run->stack_top->shadow = sentinal;
 
 	pda_run->num_retry = 0;
-	pda_run->next_region_ind = pda_run->pda_tables->token_region_inds[pda_run->pda_cs];
+	pda_run->next_region_ind = pda_tab_get(
+			&pda_run->pda_tables->token_region_inds, pda_run->pda_cs );
 	pda_run->stop_parsing = false;
 	pda_run->accum_ignore = 0;
 	pda_run->bt_point = 0;
@@ -1345,11 +1363,12 @@ static long stack_top_target( program_t *prg, struct pda_run *pda_run )
 	if ( pda_run->stack_top->state < 0 )
 		state = prg->rtd->start_states[pda_run->parser_id];
 	else {
+		struct pda_tables *tables = pda_run->pda_tables;
 		unsigned shift = pda_run->stack_top->id - 
-				pda_run->pda_tables->keys[pda_run->stack_top->state<<1];
-		unsigned offset = pda_run->pda_tables->offsets[pda_run->stack_top->state] + shift;
-		int index = pda_run->pda_tables->indices[offset];
-		state = pda_run->pda_tables->targs[index];
+				pda_tab_get( &tables->keys, pda_run->stack_top->state<<1 );
+		unsigned offset = pda_tab_get( &tables->offsets, pda_run->stack_top->state ) + shift;
+		int index = pda_tab_get( &tables->indices, offset );
+		state = pda_tab_get( &tables->targs, index );
 	}
 	return state;
 }
@@ -1368,7 +1387,8 @@ static long parse_token( program_t *prg, tree_t **sp,
 		struct pda_run *pda_run, struct input_impl *is, long entry )
 {
 	int pos;
-	unsigned int *action;
+	long act;
+	unsigned int action;
 	int rhs_len;
 	int owner;
 	int induce_reject;
@@ -1397,25 +1417,25 @@ again:
 	pda_run->lel = pda_run->parse_input;
 	pda_run->cur_state = pda_run->pda_cs;
 
-	if ( pda_run->lel->id < pda_run->pda_tables->keys[pda_run->cur_state<<1] ||
-			pda_run->lel->id > pda_run->pda_tables->keys[(pda_run->cur_state<<1)+1] )
+	if ( pda_run->lel->id < pda_tab_get( &pda_run->pda_tables->keys, pda_run->cur_state<<1 ) ||
+			pda_run->lel->id > pda_tab_get( &pda_run->pda_tables->keys, (pda_run->cur_state<<1)+1 ) )
 	{
 		debug( prg, REALM_PARSE, "parse error, no transition 1\n" );
 		push_bt_point( prg, pda_run );
 		goto parse_error;
 	}
 
-	ind_pos = pda_run->pda_tables->offsets[pda_run->cur_state] + 
-		(pda_run->lel->id - pda_run->pda_tables->keys[pda_run->cur_state<<1]);
+	ind_pos = pda_tab_get( &pda_run->pda_tables->offsets, pda_run->cur_state ) + 
+		(pda_run->lel->id - pda_tab_get( &pda_run->pda_tables->keys, pda_run->cur_state<<1 ));
 
-	owner = pda_run->pda_tables->owners[ind_pos];
+	owner = pda_tab_get( &pda_run->pda_tables->owners, ind_pos );
 	if ( owner != pda_run->cur_state ) {
 		debug( prg, REALM_PARSE, "parse error, no transition 2\n" );
 		push_bt_point( prg, pda_run );
 		goto parse_error;
 	}
 
-	pos = pda_run->pda_tables->indices[ind_pos];
+	pos = pda_tab_get( &pda_run->pda_tables->indices, ind_pos );
 	if ( pos < 0 ) {
 		debug( prg, REALM_PARSE, "parse error, no transition 3\n" );
 		push_bt_point( prg, pda_run );
@@ -1425,16 +1445,17 @@ again:
 	/* Checking complete. */
 
 	induce_reject = false;
-	pda_run->pda_cs = pda_run->pda_tables->targs[pos];
-	action = pda_run->pda_tables->actions + pda_run->pda_tables->act_inds[pos];
+	pda_run->pda_cs = pda_tab_get( &pda_run->pda_tables->targs, pos );
+	act = pda_tab_get( &pda_run->pda_tables->act_inds, pos );
 	if ( pda_run->lel->retry_lower )
-		action += pda_run->lel->retry_lower;
+		act += pda_run->lel->retry_lower;
+	action = pda_tab_get( &pda_run->pda_tables->actions, act );
 
 	/*
 	 * Shift
 	 */
 
-	if ( *action & act_sb ) {
+	if ( action & act_sb ) {
 		debug( prg, REALM_PARSE, "shifted: %s\n", 
 				prg->rtd->lel_info[pda_run->lel->id].name );
 		/* Consume. */
@@ -1462,9 +1483,10 @@ again:
 			//colm_tree_upref( prg, pdaRun->tree );
 			ref->next = pda_run->token_list;
 			pda_run->token_list = ref;
+			pda_run->lel->token_ref = ref;
 		}
 
-		if ( action[1] == 0 )
+		if ( pda_tab_get( &pda_run->pda_tables->actions, act + 1 ) == 0 )
 			pda_run->lel->retry_lower = 0;
 		else {
 			debug( prg, REALM_PARSE, "retry: %p\n", pda_run->stack_top );
@@ -1475,13 +1497,30 @@ again:
 		}
 
 		pda_run->shift_count += 1;
+
+		/* Auto commit when a nonterminal is complete and no retry can take
+		 * the parse back into it. */
+		if ( prg->auto_commit && pda_run->num_retry == 0 &&
+				pda_run->lel->id >= prg->rtd->first_non_term_id )
+		{
+			debug( prg, REALM_PARSE, "auto commit\n" );
+			pda_run->commit_shift_count = pda_run->shift_count;
+
+			if ( pda_run->reducer )
+				commit_reduce( prg, sp, pda_run );
+			else
+				commit_release( prg, sp, pda_run );
+
+			if ( pda_run->fail_parsing )
+				goto fail;
+		}
 	}
 
 	/* 
 	 * Commit
 	 */
 
-	if ( pda_run->pda_tables->commit_len[pos] != 0 ) {
+	if ( pda_tab_get( &pda_run->pda_tables->commit_len, pos ) != 0 ) {
 		debug( prg, REALM_PARSE, "commit point\n" );
 		pda_run->commit_shift_count = pda_run->shift_count;
 
@@ -1498,17 +1537,17 @@ again:
 	 * Reduce
 	 */
 
-	if ( *action & act_rb ) {
+	if ( action & act_rb ) {
 		int r, object_length;
 		parse_tree_t *last, *child;
 		kid_t *attrs;
 		kid_t *data_last, *data_child;
 
 		/* If there was shift don't attach again. */
-		if ( !( *action & act_sb ) && pda_run->lel->id < prg->rtd->first_non_term_id )
+		if ( !( action & act_sb ) && pda_run->lel->id < prg->rtd->first_non_term_id )
 			attach_right_ignore( prg, sp, pda_run, pda_run->stack_top );
 
-		pda_run->reduction = *action >> 2;
+		pda_run->reduction = action >> 2;
 
 		if ( pda_run->parse_input != 0 )
 			pda_run->parse_input->cause_reduce += 1;
@@ -1530,15 +1569,28 @@ again:
 		pda_run->red_lel->retry_upper = pda_run->lel->retry_lower;
 		pda_run->lel->retry_lower = 0;
 
-		/* Allocate the attributes. */
-		object_length = prg->rtd->lel_info[pda_run->red_lel->id].object_length;
-		attrs = alloc_attrs( prg, object_length );
+		/* Allocate the attributes. Fixed-arity productions get the attributes
+		 * and children in one run. Repeats and lists stay linked. */
+		struct lang_el_info *red_info = &prg->rtd->lel_info[pda_run->red_lel->id];
+		object_length = red_info->object_length;
+		rhs_len = prg->rtd->prod_info[pda_run->reduction].length;
+
+		kid_t *run = 0;
+		if ( !red_info->repeat && !red_info->list &&
+				kid_run_possible( object_length + rhs_len ) )
+		{
+			run = kid_allocate_run( prg, object_length + rhs_len );
+			value->tree->flags |= AF_KID_RUN;
+			attrs = 0;
+		}
+		else {
+			attrs = alloc_attrs( prg, object_length );
+		}
 
 		/* Build the list of children. We will be giving up a reference when we
 		 * detach parse tree and data tree, but gaining the reference when we
 		 * put the children under the new data tree. No need to alter refcounts
 		 * here. */
-		rhs_len = prg->rtd->prod_info[pda_run->reduction].length;
 		child = last = 0;
 		data_child = data_last = 0;
 		for ( r = 0; r < rhs_len; r++ ) {
@@ -1555,19 +1607,34 @@ again:
 
 			/* Reverse list. */
 			child->next = last;
-			data_child->next = data_last;
 
 			/* Track last for reversal. */
 			last = child;
-			data_last = data_child;
+
+			if ( run != 0 ) {
+				/* Move the data into the run. The token list follows a
+				 * token's kid. */
+				kid_t *slot = &run[object_length + rhs_len - 1 - r];
+				slot->tree = data_child->tree;
+				if ( child->token_ref != 0 )
+					child->token_ref->kid = slot;
+				kid_free( prg, data_child );
+			}
+			else {
+				data_child->next = data_last;
+				data_last = data_child;
+			}
 		}
 
 		pda_run->red_lel->child = child;
-		pda_run->red_lel->shadow->tree->child = kid_list_concat( attrs, data_child );
+		if ( run != 0 )
+			pda_run->red_lel->shadow->tree->child = run;
+		else
+			pda_run->red_lel->shadow->tree->child = kid_list_concat( attrs, data_child );
 
 		debug( prg, REALM_PARSE, "reduced: %s rhsLen %d\n",
 				prg->rtd->prod_info[pda_run->reduction].name, rhs_len );
-		if ( action[1] == 0 )
+		if ( pda_tab_get( &pda_run->pda_tables->actions, act + 1 ) == 0 )
 			pda_run->red_lel->retry_upper = 0;
 		else {
 			pda_run->red_lel->retry_upper += 1;
@@ -1680,7 +1747,8 @@ parse_error:
 		else if ( pda_run->check_next ) {
 			pda_run->check_next = false;
 
-			if ( pda_run->next > 0 && pda_run->pda_tables->token_regions[pda_run->next] != 0 ) {
+			if ( pda_run->next > 0 && pda_tab_get( &pda_run->pda_tables->token_regions,
+					pda_run->next ) != 0 ) {
 				debug( prg, REALM_PARSE, "found a new region\n" );
 				pda_run->num_retry -= 1;
 				pda_run->pda_cs = stack_top_target( prg, pda_run );
@@ -1883,6 +1951,7 @@ parse_error:
 				ref_t *ref = pda_run->token_list;
 				pda_run->token_list = ref->next;
 				kid_free( prg, (kid_t*)ref );
+				pda_run->undo_lel->token_ref = 0;
 
 				assert( pda_run->accum_ignore == 0 );
 				detach_left_ignore( prg, sp, pda_run, pda_run->parse_input );
@@ -1915,7 +1984,8 @@ fail:
 	return PCR_DONE;
 
 _out:
-	pda_run->next_region_ind = pda_run->pda_tables->token_region_inds[pda_run->pda_cs];
+	pda_run->next_region_ind = pda_tab_get(
+			&pda_run->pda_tables->token_region_inds, pda_run->pda_cs );
 
 	/* COROUTINE */
 	case PCR_DONE:
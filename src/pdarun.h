@@ -212,20 +212,52 @@ typedef struct _CaptureAttr
 	long offset;
 } CaptureAttr;
 
+/* Element types of parse table arrays. Generated programs store each array
+ * in the smallest type that holds its values. The compiler builds them as
+ * int and unsigned int. */
+enum pda_tab_type
+{
+	PDA_TAB_S8 = 1,
+	PDA_TAB_U8,
+	PDA_TAB_S16,
+	PDA_TAB_U16,
+	PDA_TAB_S32,
+	PDA_TAB_U32
+};
+
+/* A typed view of a parse table array. */
+struct pda_tab
+{
+	const void *data;
+	int type;
+};
+
+inline static long pda_tab_get( const struct pda_tab *tab, long i )
+{
+	switch ( tab->type ) {
+		case PDA_TAB_S8:  return ((const signed char*)tab->data)[i];
+		case PDA_TAB_U8:  return ((const unsigned char*)tab->data)[i];
+		case PDA_TAB_S16: return ((const short*)tab->data)[i];
+		case PDA_TAB_U16: return ((const unsigned short*)tab->data)[i];
+		case PDA_TAB_S32: return ((const int*)tab->data)[i];
+		default:          return ((const unsigned int*)tab->data)[i];
+	}
+}
+
 struct pda_tables
 {
 	/* Parser table data. */
-	int *indices;
-	int *owners;
-	int *keys;
-	unsigned int *offsets;
-	unsigned int *targs;
-	unsigned int *act_inds;
-	unsigned int *actions;
-	int *commit_len;
-	int *token_region_inds;
-	int *token_regions;
-	int *token_pre_regions;
+	struct pda_tab indices;
+	struct pda_tab owners;
+	struct pda_tab keys;
+	struct pda_tab offsets;
+	struct pda_tab targs;
+	struct pda_tab act_inds;
+	struct pda_tab actions;
+	struct pda_tab commit_len;
+	struct pda_tab token_region_inds;
+	struct pda_tab token_regions;
+	struct pda_tab token_pre_regions;
 
 	int num_indices;
 	int num_keys;
@@ -453,16 +485,22 @@ long colm_parse_undo_frag( struct colm_program *prg, tree_t **sp, struct pda_run
 		input_t *input, long entry, long steps );
 
 void commit_clear_kid_list( program_t *prg, tree_t **sp, kid_t *kid );
+void commit_clear_tree_kids( program_t *prg, tree_t **sp, tree_t *tree );
 void commit_clear_parse_tree( program_t *prg, tree_t **sp,
 		struct pda_run *pda_run, parse_tree_t *pt );
 void commit_reduce( program_t *prg, tree_t **root,
 		struct pda_run *pda_run );
+void commit_release( program_t *prg, tree_t **root,
+		struct pda_run *pda_run );
 
 tree_t *get_parsed_root( struct pda_run *pda_run, int stop );
 
 void colm_parse_reduce_commit( program_t *prg, tree_t **sp,
 		struct pda_run *pda_run );
 
+long colm_reparse_append( program_t *prg, tree_t **sp, struct input_impl *impl,
+		tree_t *old, long offset, long deleted, const char *ins_data, long ins_length );
+
 #ifdef __cplusplus
 }
 #endif
@@ -143,12 +143,51 @@ void kid_free( program_t *prg, kid_t *el )
 
 void kid_clear( program_t *prg )
 {
+	int i;
 	pool_alloc_clear( &prg->kid_pool );
+	for ( i = 0; i < KID_RUN_MAX; i++ )
+		pool_alloc_clear( &prg->kid_run_pool[i] );
 }
 
+/* Kids of a run that was broken up are freed one at a time into the kid pool,
+ * so only the sum over all the pools is meaningful. */
 long kid_num_lost( program_t *prg )
 {
-	return pool_alloc_num_lost( &prg->kid_pool );
+	long i, lost = pool_alloc_num_lost( &prg->kid_pool );
+	for ( i = 0; i < KID_RUN_MAX; i++ )
+		lost += pool_alloc_num_lost( &prg->kid_run_pool[i] ) * ( i + 1 );
+	return lost;
+}
+
+/* Kids allocated with malloc must each be freeable on their own. */
+int kid_run_possible( long length )
+{
+#ifdef POOL_MALLOC
+	return 0;
+#else
+	return length > 0 && length <= KID_RUN_MAX;
+#endif
+}
+
+/*
+ * A run of kids in one allocation, linked in order. Taken from a pool
+ * dedicated to the length.
+ */
+kid_t *kid_allocate_run( program_t *prg, long length )
+{
+	assert( length > 0 && length <= KID_RUN_MAX );
+	kid_t *run = (kid_t*) pool_alloc_allocate( &prg->kid_run_pool[length-1] );
+
+	long i;
+	for ( i = 0; i < length - 1; i++ )
+		run[i].next = &run[i+1];
+	return run;
+}
+
+void kid_free_run( program_t *prg, kid_t *run, long length )
+{
+	assert( length > 0 && length <= KID_RUN_MAX );
+	pool_alloc_free( &prg->kid_run_pool[length-1], run );
 }
 
 /* 
@@ -41,6 +41,10 @@ void kid_free( program_t *prg, kid_t *el );
 void kid_clear( program_t *prg );
 long kid_num_lost( program_t *prg );
 
+int kid_run_possible( long length );
+kid_t *kid_allocate_run( program_t *prg, long length );
+void kid_free_run( program_t *prg, kid_t *run, long length );
+
 tree_t *tree_allocate( program_t *prg );
 void tree_free( program_t *prg, tree_t *el );
 void tree_clear( program_t *prg );
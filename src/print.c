@@ -34,49 +34,105 @@
 
 #define BUFFER_INITIAL_SIZE 4096
 
+/*
+ * Escaping scans a word at a time for bytes that need attention, so runs of
+ * plain text go out in a single call. The word tests may report a byte that
+ * turns out to be fine (tab, newline); the byte loop sorts those out.
+ */
+
+typedef unsigned long scan_word_t;
+
+#define SCAN_ONES ( ~(scan_word_t)0 / 255 )
+#define SCAN_HIGHS ( SCAN_ONES * 128 )
+
+/* Any byte equal to c. */
+#define scan_has_byte( w, c ) \
+	( ( ( ( (w) ^ ( SCAN_ONES * (c) ) ) - SCAN_ONES ) & ~( (w) ^ ( SCAN_ONES * (c) ) ) & SCAN_HIGHS ) != 0 )
+
+/* Any byte below the byte in lt, or at or above 0x7f. */
+static inline int scan_has_special( scan_word_t w, scan_word_t lt )
+{
+	return ( ( ( ( w - lt ) & ~w ) | w | ( w + SCAN_ONES * 1 ) ) & SCAN_HIGHS ) != 0;
+}
+
+static long xml_plain_run( const char *data, long len )
+{
+	long i = 0;
+	while ( i + (long)sizeof(scan_word_t) <= len ) {
+		scan_word_t w;
+		memcpy( &w, data + i, sizeof(w) );
+		if ( scan_has_special( w, SCAN_ONES * 0x20 ) || scan_has_byte( w, '<' ) ||
+				scan_has_byte( w, '>' ) || scan_has_byte( w, '&' ) )
+			break;
+		i += sizeof(scan_word_t);
+	}
+
+	while ( i < len ) {
+		char c = data[i];
+		if ( c == '<' || c == '>' || c == '&' )
+			break;
+		if ( !( ( 32 <= c && c <= 126 ) || c == '\t' || c == '\n' || c == '\r' ) )
+			break;
+		i += 1;
+	}
+	return i;
+}
+
 static void xml_escape_data( struct colm_print_args *print_args, const char *data, long len )
 {
-	int i;
-	for ( i = 0; i < len; i++ ) {
+	long i = 0;
+	while ( i < len ) {
+		long run = xml_plain_run( data + i, len - i );
+		if ( run > 0 ) {
+			print_args->out( print_args, data + i, run );
+			i += run;
+			if ( i == len )
+				break;
+		}
+
 		if ( data[i] == '<' )
 			print_args->out( print_args, "&lt;", 4 );
 		else if ( data[i] == '>' )
 			print_args->out( print_args, "&gt;", 4 );
 		else if ( data[i] == '&' )
 			print_args->out( print_args, "&amp;", 5 );
-		else if ( (32 <= data[i] && data[i] <= 126) || 
-				data[i] == '\t' || data[i] == '\n' || data[i] == '\r' )
-		{
-			print_args->out( print_args, &data[i], 1 );
-		}
 		else {
 			char out[64];
 			sprintf( out, "&#%u;", ((unsigned)data[i]) );
 			print_args->out( print_args, out, strlen(out) );
 		}
+		i += 1;
 	}
 }
 
+/* Strings at least this long take over the collect buffer's storage. Shorter
+ * ones are copied out and the buffer is kept. */
+#define COLLECT_HANDOFF_SIZE 4096
+
 void init_str_collect( str_collect_t *collect )
 {
 	collect->data = malloc( BUFFER_INITIAL_SIZE );
 	collect->allocated = BUFFER_INITIAL_SIZE;
 	collect->length = 0;
+	collect->reserve = 0;
 	collect->indent.indent = 0;
 	collect->indent.level = COLM_INDENT_OFF;
 }
 
 void str_collect_destroy( str_collect_t *collect )
 {
-	free( collect->data );
+	if ( collect->data != 0 )
+		free( collect->data - collect->reserve );
 }
 
 void str_collect_append( str_collect_t *collect, const char *data, long len )
 {
 	long new_len = collect->length + len;
 	if ( new_len > collect->allocated ) {
+		char *base = collect->data - collect->reserve;
 		collect->allocated = new_len * 2;
-		collect->data = realloc( collect->data, collect->allocated );
+		base = realloc( base, collect->reserve + collect->allocated );
+		collect->data = base + collect->reserve;
 	}
 	memcpy( collect->data + collect->length, data, len );
 	collect->length += len;
@@ -87,6 +143,68 @@ void str_collect_clear( str_collect_t *collect )
 	collect->length = 0;
 }
 
+/* Take the program's collect buffer, or a fresh one if it is already out. */
+str_collect_t *colm_collect_borrow( program_t *prg )
+{
+	str_collect_t *collect = prg->str_collect;
+	if ( collect != 0 ) {
+		prg->str_collect = 0;
+	}
+	else {
+		collect = malloc( sizeof(str_collect_t) );
+		collect->data = 0;
+		collect->length = 0;
+		collect->reserve = sizeof(head_t);
+	}
+
+	/* Storage goes with long strings. Start again at the initial size. */
+	if ( collect->data == 0 ) {
+		char *base = malloc( collect->reserve + BUFFER_INITIAL_SIZE );
+		collect->data = base + collect->reserve;
+		collect->allocated = BUFFER_INITIAL_SIZE;
+	}
+
+	collect->indent.indent = 0;
+	collect->indent.level = COLM_INDENT_OFF;
+	return collect;
+}
+
+void colm_collect_return( program_t *prg, str_collect_t *collect )
+{
+	if ( prg->str_collect == 0 ) {
+		collect->length = 0;
+		prg->str_collect = collect;
+	}
+	else {
+		str_collect_destroy( collect );
+		free( collect );
+	}
+}
+
+/* Make a string from what was collected, then return the collector. Long
+ * strings are given the buffer's storage, with the head written into the
+ * reserved space in front. */
+head_t *colm_collect_to_string( program_t *prg, str_collect_t *collect )
+{
+	head_t *head;
+	if ( collect->reserve == sizeof(head_t) && collect->length >= COLLECT_HANDOFF_SIZE ) {
+		head = realloc( collect->data - collect->reserve,
+				sizeof(head_t) + collect->length );
+		head->data = (char*)(head+1);
+		head->length = collect->length;
+		head->location = 0;
+
+		collect->data = 0;
+		collect->allocated = 0;
+	}
+	else {
+		head = string_alloc_full( prg, collect->data, collect->length );
+	}
+
+	colm_collect_return( prg, collect );
+	return head;
+}
+
 #define INT_SZ 32
 
 void print_str( struct colm_print_args *print_args, head_t *str )
@@ -102,7 +220,7 @@ void append_collect( struct colm_print_args *args, const char *data, int length
 void append_file( struct colm_print_args *args, const char *data, int length )
 {
 	struct stream_impl_data *impl = (struct stream_impl_data*) args->arg;
-	fwrite( data, 1, length, impl->file );
+	stream_impl_write( impl, data, length );
 }
 
 static void out_indent( struct colm_print_args *args, const char *data, int length )
@@ -602,6 +720,7 @@ void colm_print_xml_stdout( program_t *prg, tree_t **sp,
 			impl, comm_attr, comm_attr, trim, &impl->indent,
 			&append_file, &xml_open, &xml_term, &xml_close };
 	colm_print_tree_args( prg, sp, &print_args, tree );
+	stream_impl_flush_out( impl );
 }
 
 static void postfix_open( program_t *prg, tree_t **sp, struct colm_print_args *args,
@@ -609,19 +728,42 @@ static void postfix_open( program_t *prg, tree_t **sp, struct colm_print_args *a
 {
 }
 
+static long postfix_plain_run( const char *data, long len )
+{
+	long i = 0;
+	while ( i + (long)sizeof(scan_word_t) <= len ) {
+		scan_word_t w;
+		memcpy( &w, data + i, sizeof(w) );
+		if ( scan_has_special( w, SCAN_ONES * 0x21 ) || scan_has_byte( w, '\\' ) )
+			break;
+		i += sizeof(scan_word_t);
+	}
+
+	while ( i < len && data[i] != '\\' && 33 <= data[i] && data[i] <= 126 )
+		i += 1;
+	return i;
+}
+
 static void postfix_term_data( struct colm_print_args *args, const char *data, long len )
 {
-	int i;
-	for ( i = 0; i < len; i++ ) {
+	long i = 0;
+	while ( i < len ) {
+		long run = postfix_plain_run( data + i, len - i );
+		if ( run > 0 ) {
+			args->out( args, data + i, run );
+			i += run;
+			if ( i == len )
+				break;
+		}
+
 		if ( data[i] == '\\' )
 			args->out( args, "\\5c", 3 );
-		else if ( 33 <= data[i] && data[i] <= 126 )
-			args->out( args, &data[i], 1 );
 		else {
 			char out[64];
 			sprintf( out, "\\%02x", ((unsigned char)data[i]) );
 			args->out( args, out, strlen(out) );
 		}
+		i += 1;
 	}
 }
 
@@ -735,21 +877,18 @@ void colm_postfix_tree_collect( program_t *prg, tree_t **sp,
 	colm_print_tree_args( prg, sp, &print_args, tree );
 }
 
-#if 0
-void colm_postfix_tree_file( program_t *prg, tree_t **sp, struct stream_impl *impl,
-		tree_t *tree, int trim )
+/* Writes through the stream's output buffer, which is flushed at the end. */
+void colm_postfix_tree_file( program_t *prg, tree_t **sp,
+		struct stream_impl_data *impl, tree_t *tree, int trim )
 {
 	struct colm_print_args print_args = {
-			impl, false, false, false, &append_file, 
-			&postfix_open, &postfix_term, &postfix_close
+			impl, false, false, false, &impl->indent,
+			&append_file, &postfix_open, &postfix_term, &postfix_close
 	};
 
 	colm_print_tree_args( prg, sp, &print_args, tree );
-
-	//struct stream_impl *impl = (struct stream_impl*) args->arg;
-	fflush( impl->file );
+	stream_impl_flush_out( impl );
 }
-#endif
 
 void colm_print_tree_collect_xml( program_t *prg, tree_t **sp,
 		str_collect_t *collect, tree_t *tree, int trim )
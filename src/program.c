@@ -156,6 +156,33 @@ void vm_clear( program_t *prg )
 	}
 }
 
+/* Drop back to the first stack block, which holds the root. One of the
+ * others is kept as the reserve. */
+static void vm_reset( program_t *prg )
+{
+	while ( prg->stack_block->next != 0 ) {
+		struct stack_block *b = prg->stack_block;
+		prg->stack_block = prg->stack_block->next;
+
+		if ( prg->reserve == 0 || prg->reserve->len < b->len ) {
+			struct stack_block *old = prg->reserve;
+			prg->reserve = b;
+			b = old;
+		}
+
+		if ( b != 0 ) {
+			free( b->data );
+			free( b );
+		}
+	}
+
+	prg->stack_block->offset = 0;
+	prg->sb_beg = prg->stack_block->data;
+	prg->sb_end = prg->stack_block->data + prg->stack_block->len;
+	prg->sb_total = 0;
+	prg->stack_root = prg->sb_end;
+}
+
 tree_t *colm_return_val( struct colm_program *prg )
 {
 	return prg->return_val;
@@ -171,8 +198,24 @@ void colm_set_reduce_clean( struct colm_program *prg, unsigned char reduce_clean
 	prg->reduce_clean = reduce_clean;
 }
 
+void colm_set_auto_commit( struct colm_program *prg, unsigned char auto_commit )
+{
+	prg->auto_commit = auto_commit;
+}
+
+void colm_set_hash_cons( struct colm_program *prg, unsigned char hash_cons )
+{
+	prg->hash_cons = hash_cons;
+}
+
+void colm_set_tree_hash( struct colm_program *prg, unsigned char tree_hash )
+{
+	prg->tree_hash = tree_hash;
+}
+
 program_t *colm_new_program( struct colm_sections *rtd )
 {
+	int i;
 	program_t *prg = malloc(sizeof(program_t));
 	memset( prg, 0, sizeof(program_t) );
 
@@ -184,6 +227,8 @@ program_t *colm_new_program( struct colm_sections *rtd )
 	prg->reduce_clean = 1;
 
 	init_pool_alloc( &prg->kid_pool, sizeof(kid_t) );
+	for ( i = 0; i < KID_RUN_MAX; i++ )
+		init_pool_alloc( &prg->kid_run_pool[i], sizeof(kid_t) * ( i + 1 ) );
 	init_pool_alloc( &prg->tree_pool, sizeof(tree_t) );
 	init_pool_alloc( &prg->parse_tree_pool, sizeof(parse_tree_t) );
 	init_pool_alloc( &prg->head_pool, sizeof(head_t) );
@@ -241,6 +286,79 @@ static void colm_clear_heap( program_t *prg, tree_t **sp )
 	}
 }
 
+static void free_run_bufs( struct run_buf *rb )
+{
+	while ( rb != 0 ) {
+		struct run_buf *next = rb->next;
+		free( rb );
+		rb = next;
+	}
+}
+
+/*
+ * Return a program to the state colm_new_program leaves it in, ready for
+ * another colm_run_program. All trees and structs the program holds are
+ * released, but the pool blocks they came from, the reserve stack block and
+ * the consumed run buffers are kept for reuse. Settings (debug realms, reduce
+ * clean, auto commit, reduce context) are retained. Any trees the caller still
+ * holds from the program are invalid afterwards.
+ */
+void colm_reset_program( program_t *prg )
+{
+	tree_t **sp = prg->stack_root;
+
+	colm_tree_downref( prg, sp, prg->return_val );
+	prg->return_val = 0;
+
+	colm_clear_heap( prg, sp );
+	colm_hash_cons_clear( prg, sp );
+	prg->heap.head = prg->heap.tail = 0;
+	prg->global = 0;
+	prg->stdin_val = prg->stdout_val = prg->stderr_val = 0;
+
+	colm_tree_downref( prg, sp, prg->error );
+	prg->error = 0;
+
+	/* Tokens that pointed into the consumed buffers are gone. Keep the buffers
+	 * of standard size, oversized ones are freed. */
+	struct run_buf *rb = prg->alloc_run_buf;
+	while ( rb != 0 ) {
+		struct run_buf *next = rb->next;
+		if ( rb->length > FSM_BUFSIZE )
+			free( rb );
+		else {
+			rb->next = prg->free_run_buf;
+			prg->free_run_buf = rb;
+		}
+		rb = next;
+	}
+	prg->alloc_run_buf = 0;
+
+	vm_reset( prg );
+
+	colm_unmap_snapshots( prg );
+
+	memset( &prg->split_stats, 0, sizeof(prg->split_stats) );
+
+	prg->induce_exit = 0;
+	prg->exit_status = 0;
+	prg->argc = 0;
+	prg->argv = 0;
+	prg->argl = 0;
+
+	if ( prg->stream_fns == 0 ) {
+		prg->stream_fns = malloc( sizeof(char*) * 1 );
+		prg->stream_fns[0] = 0;
+	}
+
+	colm_alloc_global( prg );
+}
+
+void colm_split_stats( program_t *prg, struct colm_split_stats *stats )
+{
+	*stats = prg->split_stats;
+}
+
 void *colm_get_reduce_ctx( struct colm_program *prg )
 {
 	return prg->red_ctx;
@@ -276,6 +394,7 @@ int colm_delete_program( program_t *prg )
 
 	colm_tree_downref( prg, sp, prg->return_val );
 	colm_clear_heap( prg, sp );
+	colm_hash_cons_clear( prg, sp );
 
 	colm_tree_downref( prg, sp, prg->error );
 
@@ -303,16 +422,18 @@ int colm_delete_program( program_t *prg )
 #endif
 
 	kid_clear( prg );
+	colm_unmap_snapshots( prg );
 	tree_clear( prg );
 	head_clear( prg );
 	parse_tree_clear( &prg->parse_tree_pool );
 	location_clear( prg );
 
-	struct run_buf *rb = prg->alloc_run_buf;
-	while ( rb != 0 ) {
-		struct run_buf *next = rb->next;
-		free( rb );
-		rb = next;
+	free_run_bufs( prg->alloc_run_buf );
+	free_run_bufs( prg->free_run_buf );
+
+	if ( prg->str_collect != 0 ) {
+		str_collect_destroy( prg->str_collect );
+		free( prg->str_collect );
 	}
 
 	vm_clear( prg );
@@ -90,6 +90,11 @@ struct colm_sections
 	CaptureAttr *capture_attr;
 	long num_captured_attr;
 
+	/* Rows of bits, one per nonterminal, giving the ids that can occur in the
+	 * tree beneath it. */
+	unsigned char *contain_sets;
+	long contain_width;
+
 	struct fsm_tables *fsm_tables;
 	struct pda_tables *pda_tables;
 	int *start_states;
@@ -136,6 +141,18 @@ struct heap_list
 	struct colm_struct *tail;
 };
 
+/* Hash-consing table of constructed trees. Open addressing, the size is a
+ * power of two. Each entry holds a reference. */
+struct cons_table
+{
+	tree_t **slots;
+	long size;
+	long used;
+};
+
+/* Longest kid list that is allocated as a single run. */
+#define KID_RUN_MAX 8
+
 struct colm_program
 {
 	long active_realm;
@@ -146,12 +163,16 @@ struct colm_program
 
 	unsigned char ctx_dep_parsing;
 	unsigned char reduce_clean;
+	unsigned char auto_commit;
+	unsigned char hash_cons;
+	unsigned char tree_hash;
 	struct colm_sections *rtd;
 	struct colm_struct *global;
 	int induce_exit;
 	int exit_status;
 
 	struct pool_alloc kid_pool;
+	struct pool_alloc kid_run_pool[KID_RUN_MAX];
 	struct pool_alloc tree_pool;
 	struct pool_alloc parse_tree_pool;
 	struct pool_alloc head_pool;
@@ -169,6 +190,17 @@ struct colm_program
 	tree_t *error;
 
 	struct run_buf *alloc_run_buf;
+	struct run_buf *free_run_buf;
+
+	struct colm_split_stats split_stats;
+
+	struct cons_table cons_table;
+
+	/* Files mapped by colm_tree_load. */
+	struct snapshot_map *snapshots;
+
+	/* Reusable buffer for converting trees to strings. */
+	struct colm_str_collect *str_collect;
 
 	/* Current stack block limits. Changed when crossing block boundaries. */
 	tree_t **sb_beg;
@@ -112,15 +112,15 @@ void RedFsm::depthFirstOrdering( RedState *state )
 		depthFirstOrdering( state->defTrans->targ );
 }
 
-/* Ordering states by transition connections. */
-void RedFsm::depthFirstOrdering()
+/* Rebuild the state list from the start state and all other entry points.
+ * States that cannot be reached are left off. */
+void RedFsm::orderFromEntries()
 {
 	/* Init on state list flags. */
 	for ( RedStateList::Iter st = stateList; st.lte(); st++ )
 		st->onStateList = false;
 	
 	/* Clear out the state list, we will rebuild it. */
-	int stateListLen = stateList.length();
 	stateList.abandon();
 
 	/* Add back to the state list from the start state and all other entry
@@ -130,11 +130,51 @@ void RedFsm::depthFirstOrdering()
 		depthFirstOrdering( *en );
 	if ( forcedErrorState )
 		depthFirstOrdering( errState );
-	
+}
+
+/* Ordering states by transition connections. */
+void RedFsm::depthFirstOrdering()
+{
+	int stateListLen = stateList.length();
+	orderFromEntries();
+
 	/* Make sure we put everything back on. */
 	assert( stateListLen == stateList.length() );
 }
 
+/* Drop the entry points of regions no parser can enter, and the states only
+ * they reach. Region zero is the error region. Returns the number of states
+ * dropped. */
+int RedFsm::pruneRegions( fsm_tables *fsmTables, bool *regionUsed )
+{
+	RedState **byId = new RedState*[stateList.length()];
+	for ( RedStateList::Iter st = stateList; st.lte(); st++ )
+		byId[st->id] = st;
+
+	/* Regions with identical machines can share an entry state. */
+	RedStateSet keep;
+	for ( long r = 1; r < fsmTables->num_regions; r++ ) {
+		long entry = fsmTables->entry_by_region[r];
+		if ( regionUsed[r] && entry != fsmTables->error_state )
+			keep.insert( byId[entry] );
+	}
+
+	for ( long r = 1; r < fsmTables->num_regions; r++ ) {
+		long entry = fsmTables->entry_by_region[r];
+		if ( !regionUsed[r] && entry != fsmTables->error_state ) {
+			if ( !keep.find( byId[entry] ) )
+				entryPoints.remove( byId[entry] );
+			fsmTables->entry_by_region[r] = fsmTables->error_state;
+		}
+	}
+
+	delete[] byId;
+
+	int stateListLen = stateList.length();
+	orderFromEntries();
+	return stateListLen - stateList.length();
+}
+
 /* Assign state ids by appearance in the state list. */
 void RedFsm::sequentialStateIds()
 {
@@ -437,7 +437,9 @@ struct RedFsm
 
 	/* Ordering states by transition connections. */
 	void depthFirstOrdering( RedState *state );
+	void orderFromEntries();
 	void depthFirstOrdering();
+	int pruneRegions( fsm_tables *fsmTables, bool *regionUsed );
 
 	/* Set state ids. */
 	void sequentialStateIds();
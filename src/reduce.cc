@@ -454,8 +454,10 @@ void Compiler::writeNeeds()
 		"static struct reduction_info ri[" << rootNamespace->reductions.length() + 1 << "];\n"
 		"\n";
 
+	/* Filled once, on first use. The table is shared by all programs created
+	 * from the same sections, which may be running on other threads. */
 	*outStream <<
-		"extern \"C\" void " << objectName << "_init_need()\n"
+		"static bool fill_need()\n"
 		"{\n";
 	
 	for ( ReductionVect::Iter r = rootNamespace->reductions; r.lte(); r++ ) {
@@ -480,7 +482,15 @@ void Compiler::writeNeeds()
 	}
 
 	*outStream <<
-		"}\n";
+		"	return true;\n"
+		"}\n"
+		"\n"
+		"extern \"C\" void " << objectName << "_init_need()\n"
+		"{\n"
+		"	static bool filled = fill_need();\n"
+		"	(void) filled;\n"
+		"}\n"
+		"\n";
 
 	*outStream <<
 		"extern \"C\" int " << objectName << "_reducer_need_tok( program_t *prg, "
@@ -752,9 +762,7 @@ void Compiler::writeParseReduce( Reduction *reduction )
 		"\n"
 		"	commit_clear_parse_tree( prg, sp, pda_run, lel->child );\n"
 		"	if ( prg->reduce_clean ) {\n"
-		"		commit_clear_kid_list( prg, sp, kid->tree->child );\n"
-		"		kid->tree->child = 0;\n"
-		"		kid->tree->flags &= ~( AF_LEFT_IGNORE | AF_RIGHT_IGNORE );\n"
+		"		commit_clear_tree_kids( prg, sp, kid->tree );\n"
 		"	}\n"
 		"	lel->child = 0;\n"
 		"\n"
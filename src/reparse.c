@@ -0,0 +1,214 @@
+/*
+ * Copyright 2007-2018 Adrian Thurston <thurston@colm.net>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * Incremental reparsing.
+ *
+ * Given a previously parsed tree and an edit of its text (byte offset,
+ * deleted length, inserted text), queue input on a fresh parser such that
+ * finishing the parser yields the tree of the edited text. The old tree is
+ * flattened into its top-level elements by descending through the root and
+ * any repeat and list nodes beneath it. Elements that end before the edit and
+ * elements that start after it are sent back as trees, which the parser
+ * shifts as a single token through the nonterminal's term dup. Only the
+ * elements the edit touches are printed, edited and rescanned.
+ *
+ * The boundaries between the elements of a top-level repeat are points where
+ * the parse states of the old and the new text converge, so this is the
+ * granularity at which subtrees are reused. If the edited text changes how
+ * neighbouring elements group, the parse of the queued input can fail. The
+ * caller should then fall back to parsing the full edited text.
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+
+#include <colm/pdarun.h>
+#include <colm/tree.h>
+#include <colm/bytecode.h>
+#include <colm/input.h>
+#include <colm/pool.h>
+#include <colm/debug.h>
+
+struct reparse_el
+{
+	tree_t *tree;
+	long end;
+};
+
+static int reparse_expand( program_t *prg, tree_t *tree )
+{
+	struct lang_el_info *lel_info = prg->rtd->lel_info;
+	return lel_info[tree->id].repeat || lel_info[tree->id].list;
+}
+
+/* Flatten the top level of the tree into an array of elements, in text
+ * order. Repeats and lists are descended into using an explicit stack of kid
+ * cursors so that long lists do not consume native stack. */
+static long reparse_elements( program_t *prg, tree_t *root, struct reparse_el **pels )
+{
+	long n = 0, alloc = 64;
+	struct reparse_el *els = malloc( sizeof(struct reparse_el) * alloc );
+
+	long depth = 0, stack_alloc = 16;
+	kid_t **stack = malloc( sizeof(kid_t*) * stack_alloc );
+
+	stack[depth++] = tree_child( prg, root );
+	while ( depth > 0 ) {
+		kid_t *kid = stack[depth-1];
+		if ( kid == 0 ) {
+			depth -= 1;
+			continue;
+		}
+
+		stack[depth-1] = kid->next;
+
+		if ( kid->tree->id >= prg->rtd->first_non_term_id &&
+				reparse_expand( prg, kid->tree ) )
+		{
+			if ( depth == stack_alloc ) {
+				stack_alloc *= 2;
+				stack = realloc( stack, sizeof(kid_t*) * stack_alloc );
+			}
+			stack[depth++] = tree_child( prg, kid->tree );
+		}
+		else {
+			if ( n == alloc ) {
+				alloc *= 2;
+				els = realloc( els, sizeof(struct reparse_el) * alloc );
+			}
+			els[n].tree = kid->tree;
+			els[n].end = -1;
+			n += 1;
+		}
+	}
+
+	free( stack );
+
+	*pels = els;
+	return n;
+}
+
+/*
+ * Queue the edited input on a fresh parser's input. Returns the number of
+ * bytes that must be rescanned.
+ */
+long colm_reparse_append( program_t *prg, tree_t **sp, struct input_impl *impl,
+		tree_t *old, long offset, long deleted, const char *ins_data, long ins_length )
+{
+	struct reparse_el *els;
+	str_collect_t collect, full;
+	long n, i, first, last, rescan;
+
+	n = reparse_elements( prg, old, &els );
+
+	/* Element text is what the element prints on its own. Ignores are held in
+	 * the tree of the token they attach to, left or right, so this includes
+	 * the element's leading and trailing ignores. */
+	init_str_collect( &collect );
+	for ( i = 0; i < n; i++ ) {
+		colm_print_tree_collect( prg, sp, &collect, els[i].tree, false );
+		els[i].end = collect.length;
+	}
+
+	/* If the elements don't account for all of the text (ignores attached
+	 * above the elements) then there is nothing to reuse. */
+	init_str_collect( &full );
+	colm_print_tree_collect( prg, sp, &full, old, false );
+	if ( full.length != collect.length ||
+			memcmp( full.data, collect.data, full.length ) != 0 )
+	{
+		debug( prg, REALM_PARSE, "reparse: element text does not "
+				"cover the tree, rescanning all\n" );
+		n = 0;
+	}
+	str_collect_destroy( &collect );
+
+	const char *text = full.data;
+	long length = full.length;
+
+	if ( offset < 0 )
+		offset = 0;
+	if ( offset > length )
+		offset = length;
+	if ( deleted < 0 )
+		deleted = 0;
+	if ( offset + deleted > length )
+		deleted = length - offset;
+
+	/* First element that the edit can reach. An insertion immediately after
+	 * an element can extend its last token, so it is included. */
+	first = 0;
+	while ( first < n && els[first].end < offset )
+		first += 1;
+
+	/* Last element that the edit can reach. Following elements are reused
+	 * only if they start strictly after the edit. */
+	last = first - 1;
+	while ( last + 1 < n ) {
+		long start = last + 1 == 0 ? 0 : els[last].end;
+		if ( start > offset + deleted )
+			break;
+		last += 1;
+	}
+
+	long dstart = first == 0 ? 0 : els[first-1].end;
+	long dend = last + 1 < n ? els[last].end : length;
+
+	debug( prg, REALM_PARSE, "reparse: %ld elements, reusing %ld before "
+			"and %ld after\n", n, first, n - last - 1 );
+
+	/* Prefix. */
+	for ( i = 0; i < first; i++ ) {
+		colm_tree_upref( prg, els[i].tree );
+		impl->funcs->append_tree( prg, impl, els[i].tree );
+	}
+
+	/* The damaged region, with the edit applied. */
+	rescan = ( offset - dstart ) + ins_length + ( dend - offset - deleted );
+	if ( rescan > 0 ) {
+		char *damaged = malloc( rescan );
+		char *dest = damaged;
+
+		memcpy( dest, text + dstart, offset - dstart );
+		dest += offset - dstart;
+		memcpy( dest, ins_data, ins_length );
+		dest += ins_length;
+		memcpy( dest, text + offset + deleted, dend - offset - deleted );
+
+		impl->funcs->append_data( prg, impl, colm_alph_from_cstr( damaged ), rescan );
+		free( damaged );
+	}
+
+	/* Suffix. */
+	for ( i = last + 1; i < n; i++ ) {
+		colm_tree_upref( prg, els[i].tree );
+		impl->funcs->append_tree( prg, impl, els[i].tree );
+	}
+
+	free( els );
+	str_collect_destroy( &full );
+
+	return rescan;
+}
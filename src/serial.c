@@ -0,0 +1,603 @@
+/*
+ * Copyright 2007-2018 Adrian Thurston <thurston@colm.net>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * Binary tree snapshots.
+ *
+ * A snapshot is a preorder dump of a tree. Each node records its id,
+ * production number, token data, location, and its kids in list order. Ignore
+ * headers and attributes are kids like any other, so ignores come back
+ * attached where they were. Numbers are unsigned LEB128 varints. Shared
+ * subtrees are written once per reference and loaded unshared. Pointer values
+ * are only meaningful in the process that made them, so they are written as
+ * null kids.
+ *
+ *   snapshot: "COLMSNP1" fingerprint num_lang_els node
+ *   node:     0                                     (null kid)
+ *           | id+1 len bytes                        (LEL_ID_STR)
+ *           | id+1 bits prod_num [len bytes]
+ *                  [name line column byte] nkids node*
+ *   name:     0 | index | index len bytes           (first use of a name)
+ *
+ * Ids are only meaningful to a program built from the same grammar. The
+ * fingerprint is taken over the language element names and object lengths and
+ * a snapshot with a different one is refused.
+ *
+ * Loading rebuilds the trees in the program's pools without any scanning or
+ * parsing. A snapshot loaded from a file is mapped read-only and token data is
+ * left in the mapping, referenced by pointer heads. The mapping lives until the
+ * program is reset or deleted.
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <colm/pdarun.h>
+#include <colm/tree.h>
+#include <colm/bytecode.h>
+#include <colm/input.h>
+#include <colm/pool.h>
+#include <colm/program.h>
+
+#define SNAPSHOT_MAGIC "COLMSNP1"
+#define SNAPSHOT_MAGIC_LEN 8
+
+#define SNB_LEFT_IGNORE  0x01
+#define SNB_RIGHT_IGNORE 0x02
+#define SNB_KID_RUN      0x04
+#define SNB_TOKDATA      0x08
+#define SNB_LOCATION     0x10
+
+struct snapshot_map
+{
+	void *data;
+	long length;
+	struct snapshot_map *next;
+};
+
+static unsigned long grammar_fingerprint( program_t *prg )
+{
+	/* FNV-1a over names and object lengths. */
+	unsigned long h = 14695981039346656037UL;
+	long i;
+	for ( i = 0; i < prg->rtd->num_lang_els; i++ ) {
+		const char *n = prg->rtd->lel_info[i].name;
+		for ( ; n != 0 && *n != 0; n++ ) {
+			h ^= (unsigned char)*n;
+			h *= 1099511628211UL;
+		}
+		h ^= (unsigned long)prg->rtd->lel_info[i].object_length + 0x100;
+		h *= 1099511628211UL;
+	}
+	return h;
+}
+
+/*
+ * Writing.
+ */
+
+struct snapshot_writer
+{
+	str_collect_t out;
+	const char **names;
+	long num_names;
+};
+
+static void put_varint( struct snapshot_writer *w, unsigned long v )
+{
+	unsigned char buf[10];
+	int n = 0;
+	do {
+		unsigned char b = v & 0x7f;
+		v >>= 7;
+		buf[n++] = v != 0 ? ( b | 0x80 ) : b;
+	}
+	while ( v != 0 );
+	str_collect_append( &w->out, (char*)buf, n );
+}
+
+static void put_bytes( struct snapshot_writer *w, const char *data, long length )
+{
+	put_varint( w, length );
+	str_collect_append( &w->out, data, length );
+}
+
+static void put_name( struct snapshot_writer *w, const char *name )
+{
+	long i;
+	if ( name == 0 ) {
+		put_varint( w, 0 );
+		return;
+	}
+
+	for ( i = 0; i < w->num_names; i++ ) {
+		if ( w->names[i] == name ) {
+			put_varint( w, i + 1 );
+			return;
+		}
+	}
+
+	w->names = realloc( w->names, sizeof(char*) * ( w->num_names + 1 ) );
+	w->names[w->num_names++] = name;
+	put_varint( w, w->num_names );
+	put_bytes( w, name, strlen( name ) );
+}
+
+/* Writes the node header. Returns true if kids follow. */
+static int put_node( struct snapshot_writer *w, tree_t *tree )
+{
+	if ( tree == 0 || tree->id == LEL_ID_PTR ) {
+		put_varint( w, 0 );
+		return false;
+	}
+
+	put_varint( w, tree->id + 1 );
+
+	if ( tree->id == LEL_ID_STR ) {
+		head_t *value = ((str_t*)tree)->value;
+		put_bytes( w, value->data, value->length );
+		return false;
+	}
+
+	head_t *tokdata = tree->id != LEL_ID_IGNORE ? tree->tokdata : 0;
+
+	unsigned long bits = 0;
+	if ( tree->flags & AF_LEFT_IGNORE )
+		bits |= SNB_LEFT_IGNORE;
+	if ( tree->flags & AF_RIGHT_IGNORE )
+		bits |= SNB_RIGHT_IGNORE;
+	if ( tree->flags & AF_KID_RUN )
+		bits |= SNB_KID_RUN;
+	if ( tokdata != 0 )
+		bits |= SNB_TOKDATA;
+	if ( tokdata != 0 && tokdata->location != 0 )
+		bits |= SNB_LOCATION;
+
+	put_varint( w, bits );
+	put_varint( w, tree->prod_num );
+
+	if ( tokdata != 0 ) {
+		put_bytes( w, tokdata->data, tokdata->length );
+		if ( tokdata->location != 0 ) {
+			put_name( w, tokdata->location->name );
+			put_varint( w, tokdata->location->line );
+			put_varint( w, tokdata->location->column );
+			put_varint( w, tokdata->location->byte );
+		}
+	}
+
+	long nkids = 0;
+	kid_t *kid;
+	for ( kid = tree->child; kid != 0; kid = kid->next )
+		nkids += 1;
+	put_varint( w, nkids );
+
+	return nkids > 0;
+}
+
+/*
+ * Serialize a tree to a malloced buffer. Returns the length. The tree is walked
+ * with an explicit stack so that deep trees do not consume native stack.
+ */
+long colm_tree_serialize( program_t *prg, tree_t *tree, char **pdata )
+{
+	struct snapshot_writer w;
+	memset( &w, 0, sizeof(w) );
+	init_str_collect( &w.out );
+
+	str_collect_append( &w.out, SNAPSHOT_MAGIC, SNAPSHOT_MAGIC_LEN );
+	put_varint( &w, grammar_fingerprint( prg ) );
+	put_varint( &w, prg->rtd->num_lang_els );
+
+	long depth = 0, stack_alloc = 16;
+	kid_t **stack = malloc( sizeof(kid_t*) * stack_alloc );
+
+	if ( put_node( &w, tree ) )
+		stack[depth++] = tree->child;
+
+	while ( depth > 0 ) {
+		kid_t *kid = stack[depth-1];
+		if ( kid == 0 ) {
+			depth -= 1;
+			continue;
+		}
+
+		stack[depth-1] = kid->next;
+
+		if ( put_node( &w, kid->tree ) ) {
+			if ( depth == stack_alloc ) {
+				stack_alloc *= 2;
+				stack = realloc( stack, sizeof(kid_t*) * stack_alloc );
+			}
+			stack[depth++] = kid->tree->child;
+		}
+	}
+
+	free( stack );
+	free( w.names );
+
+	*pdata = w.out.data;
+	return w.out.length;
+}
+
+/* Write a snapshot of a tree to a file. Returns zero on success. */
+int colm_tree_save( program_t *prg, tree_t *tree, const char *fn )
+{
+	char *data;
+	long length = colm_tree_serialize( prg, tree, &data );
+
+	int fd = open( fn, O_WRONLY | O_CREAT | O_TRUNC, 0666 );
+	if ( fd < 0 ) {
+		free( data );
+		return -1;
+	}
+
+	long written = 0;
+	while ( written < length ) {
+		ssize_t res = write( fd, data + written, length - written );
+		if ( res <= 0 )
+			break;
+		written += res;
+	}
+
+	free( data );
+	if ( close( fd ) != 0 || written < length )
+		return -1;
+	return 0;
+}
+
+/*
+ * Reading.
+ */
+
+struct snapshot_reader
+{
+	const unsigned char *p;
+	const unsigned char *pe;
+	int error;
+
+	/* Token data may stay in place. */
+	int in_place;
+
+	char **names;
+	long num_names;
+};
+
+struct snapshot_frame
+{
+	tree_t *tree;
+	kid_t *last;
+	kid_t *run;
+	long ignores;
+	long index;
+	long count;
+};
+
+static unsigned long get_varint( struct snapshot_reader *r )
+{
+	unsigned long v = 0;
+	int shift = 0;
+	while ( r->p < r->pe && shift < 64 ) {
+		unsigned char b = *r->p++;
+		v |= (unsigned long)( b & 0x7f ) << shift;
+		if ( ( b & 0x80 ) == 0 )
+			return v;
+		shift += 7;
+	}
+	r->error = true;
+	return 0;
+}
+
+static const char *get_bytes( struct snapshot_reader *r, long *plength )
+{
+	unsigned long length = get_varint( r );
+	if ( r->error || length > (unsigned long)( r->pe - r->p ) ) {
+		r->error = true;
+		return 0;
+	}
+
+	const char *data = (const char*)r->p;
+	r->p += length;
+	*plength = length;
+	return data;
+}
+
+static head_t *get_string( program_t *prg, struct snapshot_reader *r )
+{
+	long length;
+	const char *data = get_bytes( r, &length );
+	if ( r->error )
+		return 0;
+
+	return r->in_place ?
+			colm_string_alloc_pointer( prg, data, length ) :
+			string_alloc_full( prg, data, length );
+}
+
+static const char *get_name( program_t *prg, struct snapshot_reader *r )
+{
+	unsigned long index = get_varint( r );
+	if ( r->error || index == 0 )
+		return 0;
+
+	if ( index <= (unsigned long)r->num_names )
+		return r->names[index-1];
+
+	if ( index != (unsigned long)r->num_names + 1 ) {
+		r->error = true;
+		return 0;
+	}
+
+	long length;
+	const char *data = get_bytes( r, &length );
+	if ( r->error )
+		return 0;
+
+	char *name = malloc( length + 1 );
+	memcpy( name, data, length );
+	name[length] = 0;
+
+	r->names = realloc( r->names, sizeof(char*) * ( r->num_names + 1 ) );
+	r->names[r->num_names++] = colm_filename_add( prg, name );
+	free( name );
+
+	return r->names[r->num_names-1];
+}
+
+/* Read one node. Kids are left for the caller, who gets the count. */
+static tree_t *get_node( program_t *prg, struct snapshot_reader *r, long *pnkids )
+{
+	*pnkids = 0;
+
+	unsigned long id = get_varint( r );
+	if ( r->error || id == 0 )
+		return 0;
+
+	id -= 1;
+	if ( id == LEL_ID_PTR || id >= (unsigned long)prg->rtd->first_struct_el_id ) {
+		r->error = true;
+		return 0;
+	}
+
+	tree_t *tree = tree_allocate( prg );
+	tree->id = id;
+	tree->refs = 1;
+
+	if ( id == LEL_ID_STR ) {
+		long length;
+		const char *data = get_bytes( r, &length );
+		if ( r->error )
+			((str_t*)tree)->value = string_alloc_full( prg, "", 0 );
+		else
+			((str_t*)tree)->value = string_alloc_full( prg, data, length );
+		return tree;
+	}
+
+	unsigned long bits = get_varint( r );
+	tree->prod_num = get_varint( r );
+
+	if ( bits & SNB_TOKDATA ) {
+		tree->tokdata = get_string( prg, r );
+		if ( tree->tokdata != 0 && ( bits & SNB_LOCATION ) ) {
+			location_t *loc = location_allocate( prg );
+			tree->tokdata->location = loc;
+			loc->name = get_name( prg, r );
+			loc->line = get_varint( r );
+			loc->column = get_varint( r );
+			loc->byte = get_varint( r );
+		}
+	}
+
+	long nkids = get_varint( r );
+	if ( r->error || nkids < 0 || nkids > r->pe - r->p ) {
+		r->error = true;
+		return tree;
+	}
+
+	long ignores = 0;
+	if ( bits & SNB_LEFT_IGNORE ) {
+		tree->flags |= AF_LEFT_IGNORE;
+		ignores += 1;
+	}
+	if ( bits & SNB_RIGHT_IGNORE ) {
+		tree->flags |= AF_RIGHT_IGNORE;
+		ignores += 1;
+	}
+
+	/* After the ignores come the attributes. Tokens have nothing else.
+	 * Nonterminals and ignore lists have their children after them. */
+	long attrs = prg->rtd->lel_info[id].object_length;
+	int token = id != LEL_ID_IGNORE && id < (unsigned long)prg->rtd->first_non_term_id;
+	if ( ignores + attrs > nkids || ( token && ignores + attrs != nkids ) ) {
+		tree->flags &= ~( AF_LEFT_IGNORE | AF_RIGHT_IGNORE );
+		r->error = true;
+		return tree;
+	}
+
+	/* Allocate all the kids up front so the tree is always complete and can
+	 * be freed if the remainder turns out to be bad. */
+	kid_t *last = 0;
+	long i;
+	for ( i = 0; i < ignores; i++ ) {
+		kid_t *kid = kid_allocate( prg );
+		if ( last == 0 )
+			tree->child = kid;
+		else
+			last->next = kid;
+		last = kid;
+	}
+
+	long run_length = nkids - ignores;
+	if ( run_length > 0 ) {
+		kid_t *rest;
+		if ( ( bits & SNB_KID_RUN ) && kid_run_possible( run_length ) ) {
+			rest = kid_allocate_run( prg, run_length );
+			tree->flags |= AF_KID_RUN;
+		}
+		else {
+			rest = 0;
+			for ( i = 0; i < run_length; i++ ) {
+				kid_t *kid = kid_allocate( prg );
+				kid->next = rest;
+				rest = kid;
+			}
+		}
+
+		if ( last == 0 )
+			tree->child = rest;
+		else
+			last->next = rest;
+	}
+
+	*pnkids = nkids;
+	return tree;
+}
+
+/*
+ * Rebuild a tree from a snapshot. Returns the tree with one reference held by
+ * the caller, or zero if the data is not a snapshot for this program's grammar
+ * or is damaged.
+ */
+static tree_t *snapshot_read( program_t *prg, const char *data, long length, int in_place )
+{
+	struct snapshot_reader r;
+	memset( &r, 0, sizeof(r) );
+	r.p = (const unsigned char*)data;
+	r.pe = r.p + length;
+	r.in_place = in_place;
+
+	if ( length < SNAPSHOT_MAGIC_LEN || memcmp( data, SNAPSHOT_MAGIC, SNAPSHOT_MAGIC_LEN ) != 0 )
+		return 0;
+	r.p += SNAPSHOT_MAGIC_LEN;
+
+	unsigned long fingerprint = get_varint( &r );
+	unsigned long num_lang_els = get_varint( &r );
+	if ( r.error || fingerprint != grammar_fingerprint( prg ) ||
+			num_lang_els != (unsigned long)prg->rtd->num_lang_els )
+		return 0;
+
+	long depth = 0, stack_alloc = 16;
+	struct snapshot_frame *stack = malloc( sizeof(struct snapshot_frame) * stack_alloc );
+
+	long nkids;
+	tree_t *root = get_node( prg, &r, &nkids );
+	if ( root != 0 && nkids > 0 ) {
+		stack[0].tree = root;
+		stack[0].last = 0;
+		stack[0].count = nkids;
+		stack[0].index = 0;
+		depth = 1;
+	}
+
+	while ( depth > 0 && !r.error ) {
+		struct snapshot_frame *frame = &stack[depth-1];
+		if ( frame->index == frame->count ) {
+			depth -= 1;
+			continue;
+		}
+
+		kid_t *kid = frame->last == 0 ? frame->tree->child : frame->last->next;
+		frame->last = kid;
+		frame->index += 1;
+
+		kid->tree = get_node( prg, &r, &nkids );
+		if ( kid->tree != 0 && nkids > 0 ) {
+			if ( depth == stack_alloc ) {
+				stack_alloc *= 2;
+				stack = realloc( stack, sizeof(struct snapshot_frame) * stack_alloc );
+			}
+			frame = &stack[depth++];
+			frame->tree = kid->tree;
+			frame->last = 0;
+			frame->count = nkids;
+			frame->index = 0;
+		}
+	}
+
+	free( stack );
+	free( r.names );
+
+	if ( r.error || r.p != r.pe ) {
+		colm_tree_downref( prg, prg->stack_root, root );
+		return 0;
+	}
+
+	return root;
+}
+
+tree_t *colm_tree_deserialize( program_t *prg, const char *data, long length )
+{
+	return snapshot_read( prg, data, length, false );
+}
+
+/* Load a snapshot from a file. The file is mapped and token data is used in
+ * place. */
+tree_t *colm_tree_load( program_t *prg, const char *fn )
+{
+	int fd = open( fn, O_RDONLY );
+	if ( fd < 0 )
+		return 0;
+
+	struct stat st;
+	if ( fstat( fd, &st ) != 0 || st.st_size == 0 ) {
+		close( fd );
+		return 0;
+	}
+
+	void *data = mmap( 0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+	close( fd );
+	if ( data == MAP_FAILED )
+		return 0;
+
+	tree_t *tree = snapshot_read( prg, data, st.st_size, true );
+	if ( tree == 0 ) {
+		munmap( data, st.st_size );
+		return 0;
+	}
+
+	struct snapshot_map *map = malloc( sizeof(struct snapshot_map) );
+	map->data = data;
+	map->length = st.st_size;
+	map->next = prg->snapshots;
+	prg->snapshots = map;
+
+	return tree;
+}
+
+/* Release file mappings. Any trees loaded from them must already be gone. */
+void colm_unmap_snapshots( program_t *prg )
+{
+	struct snapshot_map *map = prg->snapshots;
+	while ( map != 0 ) {
+		struct snapshot_map *next = map->next;
+		munmap( map->data, map->length );
+		free( map );
+		map = next;
+	}
+	prg->snapshots = 0;
+}
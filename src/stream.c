@@ -29,6 +29,9 @@
 
 #include <colm/input.h>
 
+#include <sys/uio.h>
+#include <errno.h>
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -100,6 +103,80 @@ FILE *colm_fd_open( int fd, const char *mode )
 
 #endif
 
+/* Write all of the vector to the descriptor, retrying on short writes. */
+static void fd_writev( int fd, struct iovec *iov, int iovcnt )
+{
+	while ( iovcnt > 0 ) {
+		ssize_t w = writev( fd, iov, iovcnt );
+		if ( w < 0 ) {
+			if ( errno == EINTR )
+				continue;
+			return;
+		}
+
+		while ( iovcnt > 0 && (size_t)w >= iov->iov_len ) {
+			w -= iov->iov_len;
+			iov += 1;
+			iovcnt -= 1;
+		}
+
+		if ( iovcnt > 0 ) {
+			iov->iov_base = (char*)iov->iov_base + w;
+			iov->iov_len -= w;
+		}
+	}
+}
+
+static void stream_impl_out( struct stream_impl_data *si,
+		const char *data, long length )
+{
+	if ( si->fd >= 0 ) {
+		struct iovec iov[2];
+		int n = 0;
+		if ( si->out_len > 0 ) {
+			iov[n].iov_base = si->out_buf;
+			iov[n].iov_len = si->out_len;
+			n += 1;
+		}
+		if ( length > 0 ) {
+			iov[n].iov_base = (char*)data;
+			iov[n].iov_len = length;
+			n += 1;
+		}
+		fd_writev( si->fd, iov, n );
+	}
+	else if ( si->file != 0 ) {
+		if ( si->out_len > 0 )
+			fwrite( si->out_buf, 1, si->out_len, si->file );
+		if ( length > 0 )
+			fwrite( data, 1, length, si->file );
+	}
+
+	si->out_len = 0;
+}
+
+/* Write output to a file or fd stream. Small writes, such as the tokens and
+ * ignores of a printed tree, are gathered in the output buffer. A write that
+ * does not fit goes out together with what is buffered. */
+void stream_impl_write( struct stream_impl_data *si, const char *data, long length )
+{
+	if ( si->out_len + length <= si->out_size ) {
+		if ( si->out_buf == 0 )
+			si->out_buf = malloc( si->out_size );
+		memcpy( si->out_buf + si->out_len, data, length );
+		si->out_len += length;
+	}
+	else {
+		stream_impl_out( si, data, length );
+	}
+}
+
+void stream_impl_flush_out( struct stream_impl_data *si )
+{
+	if ( si->out_len > 0 )
+		stream_impl_out( si, 0, 0 );
+}
+
 void stream_impl_push_line( struct stream_impl_data *ss, int ll )
 {
 	if ( ss->line_len == 0 ) {
@@ -405,8 +482,13 @@ int data_undo_append_data( struct colm_program *prg, struct stream_impl_data *si
 
 static void data_destructor( program_t *prg, tree_t **sp, struct stream_impl_data *si )
 {
+	stream_impl_flush_out( si );
+
 	if ( si->file != 0 && !si->no_file_close )
 		close_stream_file( si->file );
+
+	if ( si->out_buf != 0 )
+		free( si->out_buf );
 	
 	if ( si->collect != 0 ) {
 		str_collect_destroy( si->collect );
@@ -444,32 +526,56 @@ static str_collect_t *data_get_collect( struct colm_program *prg, struct stream_
 
 static void data_flush_stream( struct colm_program *prg, struct stream_impl_data *si )
 {
+	stream_impl_flush_out( si );
+
 	if ( si->file != 0 )
 		fflush( si->file );
 }
 
 static void data_close_stream( struct colm_program *prg, struct stream_impl_data *si )
 {
+	stream_impl_flush_out( si );
+
 	if ( si->file != 0 && !si->no_file_close )
 		close_stream_file( si->file );
 
 	si->file = 0;
+	si->fd = -1;
 }
 
 static int data_get_option( struct colm_program *prg, struct stream_impl_data *si, int option )
 {
-	return si->auto_trim;
+	switch ( option ) {
+		case STREAM_OPT_OUT_BUF:
+			return si->out_size;
+		default:
+			return si->auto_trim;
+	}
 }
 
 static void data_set_option( struct colm_program *prg, struct stream_impl_data *si, int option, int value )
 {
-	si->auto_trim = value ? 1 : 0;
+	switch ( option ) {
+		case STREAM_OPT_OUT_BUF:
+			/* Resize the output buffer. Zero makes every write go out
+			 * immediately. */
+			stream_impl_flush_out( si );
+			if ( si->out_buf != 0 ) {
+				free( si->out_buf );
+				si->out_buf = 0;
+			}
+			si->out_size = value > 0 ? value : 0;
+			break;
+		default:
+			si->auto_trim = value ? 1 : 0;
+			break;
+	}
 }
 
 static void data_print_tree( struct colm_program *prg, tree_t **sp,
 		struct stream_impl_data *si, tree_t *tree, int trim )
 {
-	if ( si->file != 0 )
+	if ( si->file != 0 || si->fd >= 0 )
 		colm_print_tree_file( prg, sp, si, tree, trim );
 	else if ( si->collect != 0 )
 		colm_print_tree_collect( prg, sp, si->collect, tree, trim );
@@ -724,6 +830,9 @@ static void si_data_init( struct stream_impl_data *is, char *name )
 	/* Indentation turned off. */
 	is->indent.level = COLM_INDENT_OFF;
 	is->indent.indent = 0;
+
+	is->fd = -1;
+	is->out_size = STREAM_OUT_BUFSIZE;
 }
 
 struct stream_impl *colm_impl_new_accum( char *name )
@@ -753,12 +862,20 @@ static struct stream_impl *colm_impl_new_fd( char *name, long fd )
 	si_data_init( si, name );
 	si->funcs = (struct stream_funcs*)&file_funcs;
 
-	const char *mode = ( fd == 0 ) ? "r" : "w";
-	si->file = colm_fd_open( fd, mode );
+	if ( fd == 0 ) {
+		si->file = colm_fd_open( fd, "r" );
 #ifndef HAVE_FOPENCOOKIE
-	if ( fd == 0 || fd == 1 || fd == 2 )
 		si->no_file_close = 1;
 #endif
+	}
+	else {
+		/* Output descriptors are written directly, bypassing stdio. The
+		 * descriptor is not ours, so it is never closed. As with stdio,
+		 * stderr is not buffered. */
+		si->fd = fd;
+		if ( fd == 2 )
+			si->out_size = 0;
+	}
 	return (struct stream_impl*)si;
 }
 
@@ -848,6 +965,7 @@ stream_t *colm_stream_open_file( program_t *prg, tree_t *name, tree_t *mode )
 	else if ( memcmp( given_mode, "a", string_length(head_mode) ) == 0 )
 		fopen_mode = "ab";
 	else {
+		colm_flush_streams( prg );
 		fatal( "unknown file open mode: %s\n", given_mode );
 	}
 	
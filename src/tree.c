@@ -63,9 +63,9 @@ void free_kid_list( program_t *prg, kid_t *kid )
 	}
 }
 
-static void colm_tree_set_attr( tree_t *tree, long pos, tree_t *val )
+/* First kid after the ignore headers. */
+static kid_t *tree_attr_first( const tree_t *tree )
 {
-	long i;
 	kid_t *kid = tree->child;
 
 	if ( tree->flags & AF_LEFT_IGNORE )
@@ -73,6 +73,19 @@ static void colm_tree_set_attr( tree_t *tree, long pos, tree_t *val )
 	if ( tree->flags & AF_RIGHT_IGNORE )
 		kid = kid->next;
 
+	return kid;
+}
+
+static void colm_tree_set_attr( tree_t *tree, long pos, tree_t *val )
+{
+	long i;
+	kid_t *kid = tree_attr_first( tree );
+
+	if ( tree->flags & AF_KID_RUN ) {
+		kid[pos].tree = val;
+		return;
+	}
+
 	for ( i = 0; i < pos; i++ )
 		kid = kid->next;
 	kid->tree = val;
@@ -81,12 +94,10 @@ static void colm_tree_set_attr( tree_t *tree, long pos, tree_t *val )
 tree_t *colm_get_attr( tree_t *tree, long pos )
 {
 	long i;
-	kid_t *kid = tree->child;
+	kid_t *kid = tree_attr_first( tree );
 
-	if ( tree->flags & AF_LEFT_IGNORE )
-		kid = kid->next;
-	if ( tree->flags & AF_RIGHT_IGNORE )
-		kid = kid->next;
+	if ( tree->flags & AF_KID_RUN )
+		return kid[pos].tree;
 
 	for ( i = 0; i < pos; i++ )
 		kid = kid->next;
@@ -169,12 +180,10 @@ int colm_list_last( tree_t *tree )
 kid_t *get_attr_kid( tree_t *tree, long pos )
 {
 	long i;
-	kid_t *kid = tree->child;
+	kid_t *kid = tree_attr_first( tree );
 
-	if ( tree->flags & AF_LEFT_IGNORE )
-		kid = kid->next;
-	if ( tree->flags & AF_RIGHT_IGNORE )
-		kid = kid->next;
+	if ( tree->flags & AF_KID_RUN )
+		return &kid[pos];
 
 	for ( i = 0; i < pos; i++ )
 		kid = kid->next;
@@ -463,6 +472,198 @@ tree_t *colm_construct_object( program_t *prg, kid_t *kid, tree_t **bindings, lo
 	return tree;
 }
 
+/*
+ * Hash-consing of constructed trees. A tree is a candidate when it has no
+ * ignores or attributes, a few kids at most, and every non-null kid is itself
+ * consed. Kids can then be compared by pointer. The table holds a reference
+ * on each entry, so anyone else holding one sees a shared tree and splits
+ * before modifying.
+ */
+
+#define CONS_MAX_KIDS 8
+#define CONS_MIN_SIZE 64
+
+#define FNV_OFFSET 14695981039346656037UL
+#define FNV_PRIME 1099511628211UL
+
+static int cons_candidate( program_t *prg, const tree_t *tree )
+{
+	if ( tree->flags & ( AF_LEFT_IGNORE | AF_RIGHT_IGNORE ) )
+		return false;
+
+	if ( prg->rtd->lel_info[tree->id].object_length > 0 )
+		return false;
+
+	long n = 0;
+	kid_t *kid;
+	for ( kid = tree->child; kid != 0; kid = kid->next ) {
+		if ( ++n > CONS_MAX_KIDS )
+			return false;
+		if ( kid->tree != 0 && !( kid->tree->flags & AF_CONSED ) )
+			return false;
+	}
+	return true;
+}
+
+static unsigned long cons_hash( const tree_t *tree )
+{
+	unsigned long h = FNV_OFFSET;
+	h = ( h ^ tree->id ) * FNV_PRIME;
+	h = ( h ^ tree->prod_num ) * FNV_PRIME;
+
+	if ( tree->tokdata != 0 ) {
+		const char *d = tree->tokdata->data;
+		long i;
+		for ( i = 0; i < tree->tokdata->length; i++ )
+			h = ( h ^ (unsigned char)d[i] ) * FNV_PRIME;
+	}
+
+	kid_t *kid;
+	for ( kid = tree->child; kid != 0; kid = kid->next )
+		h = ( h ^ ( (unsigned long)kid->tree >> 4 ) ) * FNV_PRIME;
+
+	return h ^ ( h >> 32 );
+}
+
+static int cons_equal( const tree_t *t1, const tree_t *t2 )
+{
+	if ( t1->id != t2->id || t1->prod_num != t2->prod_num )
+		return false;
+
+	if ( t1->tokdata == 0 || t2->tokdata == 0 ) {
+		if ( t1->tokdata != t2->tokdata )
+			return false;
+	}
+	else if ( t1->tokdata->length != t2->tokdata->length ||
+			memcmp( t1->tokdata->data, t2->tokdata->data, t1->tokdata->length ) != 0 )
+	{
+		return false;
+	}
+
+	kid_t *k1 = t1->child, *k2 = t2->child;
+	while ( k1 != 0 && k2 != 0 ) {
+		if ( k1->tree != k2->tree )
+			return false;
+		k1 = k1->next;
+		k2 = k2->next;
+	}
+	return k1 == 0 && k2 == 0;
+}
+
+/* Free a candidate that only its creator refers to. Its kids are consed and
+ * the table still holds them, so none of them reach zero. */
+static void cons_discard( program_t *prg, tree_t *tree )
+{
+	assert( tree->refs == 1 );
+
+	kid_t *kid = tree->child;
+	while ( kid != 0 ) {
+		kid_t *next = kid->next;
+		if ( kid->tree != 0 ) {
+			assert( kid->tree->refs > 1 );
+			kid->tree->refs -= 1;
+		}
+		kid_free( prg, kid );
+		kid = next;
+	}
+
+	string_free( prg, tree->tokdata );
+	tree_free( prg, tree );
+}
+
+static void cons_place( struct cons_table *ct, tree_t *tree )
+{
+	long i = cons_hash( tree ) & ( ct->size - 1 );
+	while ( ct->slots[i] != 0 )
+		i = ( i + 1 ) & ( ct->size - 1 );
+	ct->slots[i] = tree;
+	ct->used += 1;
+}
+
+/* Make room for another entry. Entries that only the table refers to are
+ * dropped first, then the table is sized for what is left. */
+static void cons_table_grow( program_t *prg )
+{
+	struct cons_table *ct = &prg->cons_table;
+	tree_t **old = ct->slots;
+	long i, old_size = ct->size, live = 0;
+
+	for ( i = 0; i < old_size; i++ ) {
+		tree_t *tree = old[i];
+		if ( tree != 0 && tree->refs == 1 ) {
+			cons_discard( prg, tree );
+			old[i] = 0;
+		}
+		else if ( tree != 0 ) {
+			live += 1;
+		}
+	}
+
+	ct->size = CONS_MIN_SIZE;
+	while ( ct->size < ( live + 1 ) * 4 )
+		ct->size *= 2;
+	ct->slots = calloc( ct->size, sizeof(tree_t*) );
+	ct->used = 0;
+
+	for ( i = 0; i < old_size; i++ ) {
+		if ( old[i] != 0 )
+			cons_place( ct, old[i] );
+	}
+
+	free( old );
+}
+
+/* Return the shared tree identical to the freshly constructed one, entering
+ * it in the table if it is the first. Takes and returns one reference. */
+static tree_t *hash_cons( program_t *prg, tree_t *tree )
+{
+	struct cons_table *ct = &prg->cons_table;
+
+	if ( !cons_candidate( prg, tree ) )
+		return tree;
+
+	if ( ( ct->used + 1 ) * 2 > ct->size )
+		cons_table_grow( prg );
+
+	long i = cons_hash( tree ) & ( ct->size - 1 );
+	while ( ct->slots[i] != 0 ) {
+		tree_t *existing = ct->slots[i];
+		if ( cons_equal( existing, tree ) ) {
+			cons_discard( prg, tree );
+			existing->refs += 1;
+			return existing;
+		}
+		i = ( i + 1 ) & ( ct->size - 1 );
+	}
+
+	ct->slots[i] = tree;
+	ct->used += 1;
+	tree->flags |= AF_CONSED;
+
+	/* The table's reference. */
+	tree->refs += 1;
+	return tree;
+}
+
+void colm_hash_cons_clear( program_t *prg, tree_t **sp )
+{
+	struct cons_table *ct = &prg->cons_table;
+	long i;
+
+	for ( i = 0; i < ct->size; i++ ) {
+		tree_t *tree = ct->slots[i];
+		if ( tree != 0 ) {
+			tree->flags &= ~AF_CONSED;
+			colm_tree_downref( prg, sp, tree );
+		}
+	}
+
+	free( ct->slots );
+	ct->slots = 0;
+	ct->size = 0;
+	ct->used = 0;
+}
+
 /* Returns an uprefed tree. Saves us having to downref and bindings to zero to
  * return a zero-ref tree. */
 tree_t *colm_construct_tree( program_t *prg, kid_t *kid, tree_t **bindings, long pat )
@@ -560,6 +761,9 @@ tree_t *colm_construct_tree( program_t *prg, kid_t *kid, tree_t **bindings, long
 
 			colm_tree_set_attr( tree, ca->offset, attr );
 		}
+
+		if ( prg->hash_cons )
+			tree = hash_cons( prg, tree );
 	}
 
 	return tree;
@@ -834,9 +1038,21 @@ tree_t *copy_real_tree( program_t *prg, tree_t *tree, kid_t *old_next_down, kid_
 //		last = newHeader;
 	}
 
-	/* Attributes and children. */
+	/* Attributes and children. A run is copied as a run. */
+	kid_t *run = 0, *run_src = tree->flags & AF_KID_RUN ? tree_attr_first( tree ) : 0;
+	long kids = 0;
 	while ( child != 0 ) {
-		kid_t *new_kid = kid_allocate( prg );
+		if ( child == run_src ) {
+			long length = 0;
+			kid_t *k;
+			for ( k = run_src; k != 0; k = k->next )
+				length += 1;
+			run = kid_allocate_run( prg, length );
+			new_tree->flags |= AF_KID_RUN;
+		}
+
+		kid_t *new_kid = run != 0 ? run++ : kid_allocate( prg );
+		kids += 1;
 
 		/* Watch out for next down. */
 		if ( child == old_next_down )
@@ -858,6 +1074,15 @@ tree_t *copy_real_tree( program_t *prg, tree_t *tree, kid_t *old_next_down, kid_
 		child = child->next;
 		last = new_kid;
 	}
+
+	prg->split_stats.trees += 1;
+	prg->split_stats.kids += kids;
+	prg->split_stats.bytes += sizeof(tree_t) + kids * sizeof(kid_t);
+	if ( new_tree->tokdata != 0 ) {
+		prg->split_stats.bytes += sizeof(head_t);
+		if ( (char*)(new_tree->tokdata+1) == new_tree->tokdata->data )
+			prg->split_stats.bytes += new_tree->tokdata->length;
+	}
 	
 	return new_tree;
 }
@@ -883,6 +1108,7 @@ tree_t *split_tree( program_t *prg, tree_t *tree )
 			kid_t *old_next_down = 0, *new_next_down = 0;
 			tree_t *new_tree = colm_copy_tree( prg, tree, old_next_down, &new_next_down );
 			colm_tree_upref( prg, new_tree );
+			prg->split_stats.splits += 1;
 
 			/* Downref the original. Don't need to consider freeing because
 			 * refs were > 1. */
@@ -892,6 +1118,9 @@ tree_t *split_tree( program_t *prg, tree_t *tree )
 		}
 
 		assert( tree->refs == 1 );
+
+		/* Caller is about to modify it. */
+		tree->hash = 0;
 	}
 	return tree;
 }
@@ -917,15 +1146,24 @@ free_tree:
 		if ( tree->id != LEL_ID_IGNORE )
 			string_free( prg, tree->tokdata );
 
-		/* Attributes and grammar-based children. */
+		/* Attributes and grammar-based children. Ignore headers are always
+		 * allocated individually. */
 		kid_t *child = tree->child;
-		while ( child != 0 ) {
+		kid_t *run = tree->flags & AF_KID_RUN ? tree_attr_first( tree ) : 0;
+		while ( child != run ) {
 			kid_t *next = child->next;
 			vm_push_tree( child->tree );
 			kid_free( prg, child );
 			child = next;
 		}
 
+		if ( run != 0 ) {
+			long length = 0;
+			for ( ; child != 0; child = child->next, length++ )
+				vm_push_tree( child->tree );
+			kid_free_run( prg, run, length );
+		}
+
 		tree_free( prg, tree );
 		break;
 	}}
@@ -984,15 +1222,24 @@ free_tree:
 		if ( tree->id != LEL_ID_IGNORE )
 			string_free( prg, tree->tokdata );
 
-		/* Attributes and grammar-based children. */
+		/* Attributes and grammar-based children. Ignore headers are always
+		 * allocated individually. */
 		kid_t *child = tree->child;
-		while ( child != 0 ) {
+		kid_t *run = tree->flags & AF_KID_RUN ? tree_attr_first( tree ) : 0;
+		while ( child != run ) {
 			kid_t *next = child->next;
 			vm_push_tree( child->tree );
 			kid_free( prg, child );
 			child = next;
 		}
 
+		if ( run != 0 ) {
+			long length = 0;
+			for ( ; child != 0; child = child->next, length++ )
+				vm_push_tree( child->tree );
+			kid_free_run( prg, run, length );
+		}
+
 		tree_free( prg, tree );
 		break;
 	}}
@@ -1032,6 +1279,9 @@ kid_t *tree_child( program_t *prg, const tree_t *tree )
 
 	/* Skip over attributes. */
 	long object_length = lel_info[tree->id].object_length;
+	if ( ( tree->flags & AF_KID_RUN ) && object_length > 0 )
+		return kid[object_length-1].next;
+
 	long a;
 	for ( a = 0; a < object_length; a++ )
 		kid = kid->next;
@@ -1084,6 +1334,10 @@ kid_t *tree_extract_child( program_t *prg, tree_t *tree )
 	else
 		last->next = 0;
 
+	/* The kids now go their own ways and are freed individually. */
+	tree->flags &= ~AF_KID_RUN;
+	tree->hash = 0;
+
 	return kid;
 }
 
@@ -1146,6 +1400,9 @@ void ref_set_value( program_t *prg, tree_t **sp, ref_t *ref, tree_t *v )
 tree_t *get_rhs_el( program_t *prg, tree_t *lhs, long position )
 {
 	kid_t *pos = tree_child( prg, lhs );
+	if ( lhs->flags & AF_KID_RUN )
+		return pos[position].tree;
+
 	while ( position > 0 ) {
 		pos = pos->next;
 		position -= 1;
@@ -1156,6 +1413,12 @@ tree_t *get_rhs_el( program_t *prg, tree_t *lhs, long position )
 void set_rhs_el( program_t *prg, tree_t *lhs, long position, tree_t *value )
 {
 	kid_t *pos = tree_child( prg, lhs );
+	lhs->hash = 0;
+	if ( lhs->flags & AF_KID_RUN ) {
+		pos[position].tree = value;
+		return;
+	}
+
 	while ( position > 0 ) {
 		pos = pos->next;
 		position -= 1;
@@ -1167,6 +1430,9 @@ void set_rhs_el( program_t *prg, tree_t *lhs, long position, tree_t *value )
 kid_t *get_rhs_el_kid( program_t *prg, tree_t *lhs, long position )
 {
 	kid_t *pos = tree_child( prg, lhs );
+	if ( lhs->flags & AF_KID_RUN )
+		return &pos[position];
+
 	while ( position > 0 ) {
 		pos = pos->next;
 		position -= 1;
@@ -1279,7 +1545,58 @@ int match_pattern( tree_t **bindings, program_t *prg, long pat, kid_t *kid, int
 }
 
 
-long colm_cmp_tree( program_t *prg, const tree_t *tree1, const tree_t *tree2 )
+/*
+ * Explicit stack of kid cursors for the tree walkers that are called without
+ * access to the VM stack. Starts out in the struct itself and moves to the
+ * heap only for deep trees. Cursors are pushed only when there is a sibling
+ * to come back to, so right-recursive lists do not make it grow.
+ */
+#define KID_STACK_INIT 64
+
+struct kid_stack
+{
+	kid_t **data;
+	long len;
+	long alloc;
+	kid_t *init[KID_STACK_INIT];
+};
+
+static void kid_stack_init( struct kid_stack *ks )
+{
+	ks->data = ks->init;
+	ks->len = 0;
+	ks->alloc = KID_STACK_INIT;
+}
+
+static void kid_stack_push( struct kid_stack *ks, kid_t *kid )
+{
+	if ( ks->len == ks->alloc ) {
+		long alloc = ks->alloc * 2;
+		if ( ks->data == ks->init ) {
+			ks->data = malloc( sizeof(kid_t*) * alloc );
+			memcpy( ks->data, ks->init, sizeof(kid_t*) * ks->len );
+		}
+		else {
+			ks->data = realloc( ks->data, sizeof(kid_t*) * alloc );
+		}
+		ks->alloc = alloc;
+	}
+	ks->data[ks->len++] = kid;
+}
+
+static kid_t *kid_stack_pop( struct kid_stack *ks )
+{
+	return ks->data[--ks->len];
+}
+
+static void kid_stack_destroy( struct kid_stack *ks )
+{
+	if ( ks->data != ks->init )
+		free( ks->data );
+}
+
+/* Compare two trees without looking at the children. */
+static long cmp_tree_node( const tree_t *tree1, const tree_t *tree2 )
 {
 	long cmpres = 0;
 	if ( tree1 == 0 ) {
@@ -1316,27 +1633,156 @@ long colm_cmp_tree( program_t *prg, const tree_t *tree1, const tree_t *tree2 )
 				return cmpres;
 		}
 	}
+	return 0;
+}
+
+/* Compare trees in pre-order, node first, then the children. */
+long colm_cmp_tree( program_t *prg, const tree_t *tree1, const tree_t *tree2 )
+{
+	/* Shared (for example hash-consed) trees are equal without a walk. */
+	if ( tree1 == tree2 )
+		return 0;
+
+	long cmpres = cmp_tree_node( tree1, tree2 );
+	if ( cmpres != 0 || tree1 == 0 )
+		return cmpres;
+
+	struct kid_stack ks;
+	kid_stack_init( &ks );
 
 	kid_t *kid1 = tree_child( prg, tree1 );
 	kid_t *kid2 = tree_child( prg, tree2 );
 
 	while ( true ) {
-		if ( kid1 == 0 && kid2 == 0 )
-			return 0;
-		else if ( kid1 == 0 && kid2 != 0 )
-			return -1;
-		else if ( kid1 != 0 && kid2 == 0 )
-			return 1;
-		else {
-			cmpres = colm_cmp_tree( prg, kid1->tree, kid2->tree );
-			if ( cmpres != 0 )
-				return cmpres;
+		if ( kid1 == 0 || kid2 == 0 ) {
+			if ( kid1 != 0 ) {
+				cmpres = 1;
+				break;
+			}
+			else if ( kid2 != 0 ) {
+				cmpres = -1;
+				break;
+			}
+
+			/* Both child lists ended. Resume with the parents' siblings. */
+			if ( ks.len == 0 )
+				break;
+
+			kid2 = kid_stack_pop( &ks );
+			kid1 = kid_stack_pop( &ks );
+			continue;
+		}
+
+		cmpres = cmp_tree_node( kid1->tree, kid2->tree );
+		if ( cmpres != 0 )
+			break;
+
+		if ( kid1->tree == 0 || kid1->tree == kid2->tree ) {
+			kid1 = kid1->next;
+			kid2 = kid2->next;
+			continue;
+		}
+
+		if ( kid1->next != 0 || kid2->next != 0 ) {
+			kid_stack_push( &ks, kid1->next );
+			kid_stack_push( &ks, kid2->next );
+		}
+
+		kid1 = tree_child( prg, kid1->tree );
+		kid2 = tree_child( prg, kid2->tree );
+	}
+
+	kid_stack_destroy( &ks );
+	return cmpres;
+}
+
+
+/* Hash of what colm_cmp_tree looks at in a node, with the kids' hashes
+ * folded in. Kids must already be hashed. */
+static unsigned int tree_node_hash( program_t *prg, const tree_t *tree )
+{
+	unsigned long h = FNV_OFFSET;
+	const head_t *data = 0;
+
+	h = ( h ^ (unsigned short)tree->id ) * FNV_PRIME;
+	if ( tree->id == LEL_ID_PTR )
+		h = ( h ^ (unsigned long)((pointer_t*)tree)->value ) * FNV_PRIME;
+	else if ( tree->id == LEL_ID_STR )
+		data = ((str_t*)tree)->value;
+	else
+		data = tree->tokdata;
+
+	if ( data != 0 ) {
+		long i;
+		for ( i = 0; i < data->length; i++ )
+			h = ( h ^ (unsigned char)data->data[i] ) * FNV_PRIME;
+	}
+
+	kid_t *kid;
+	for ( kid = tree_child( prg, tree ); kid != 0; kid = kid->next ) {
+		unsigned int kh = kid->tree != 0 ? kid->tree->hash : 0x9e3779b9;
+		h = ( h ^ kh ) * FNV_PRIME;
+	}
+
+	unsigned int res = (unsigned int)( h ^ ( h >> 32 ) );
+	return res != 0 ? res : 1;
+}
+
+/* Structural hash, consistent with colm_cmp_tree. Computed bottom-up on
+ * demand and cached in each tree until the tree is split or modified. */
+unsigned int colm_tree_hash( program_t *prg, tree_t *tree )
+{
+	if ( tree == 0 )
+		return 0;
+	if ( tree->hash != 0 )
+		return tree->hash;
+
+	struct kid_stack ks;
+	kid_stack_init( &ks );
+
+	kid_t root = { tree, 0 };
+	kid_stack_push( &ks, &root );
+
+	while ( ks.len > 0 ) {
+		tree_t *top = ks.data[ks.len-1]->tree;
+		if ( top->hash != 0 ) {
+			kid_stack_pop( &ks );
+			continue;
+		}
+
+		/* Hash the kids first, then come back to this one. */
+		int pending = false;
+		kid_t *kid;
+		for ( kid = tree_child( prg, top ); kid != 0; kid = kid->next ) {
+			if ( kid->tree != 0 && kid->tree->hash == 0 ) {
+				kid_stack_push( &ks, kid );
+				pending = true;
+			}
+		}
+
+		if ( !pending ) {
+			top->hash = tree_node_hash( prg, top );
+			kid_stack_pop( &ks );
 		}
-		kid1 = kid1->next;
-		kid2 = kid2->next;
 	}
+
+	kid_stack_destroy( &ks );
+	return tree->hash;
 }
 
+/* Equality test. Where hashing is enabled, differing hashes settle it without
+ * a walk. */
+int colm_equal_tree( program_t *prg, tree_t *tree1, tree_t *tree2 )
+{
+	if ( tree1 == tree2 )
+		return true;
+
+	if ( prg->tree_hash && tree1 != 0 && tree2 != 0 &&
+			colm_tree_hash( prg, tree1 ) != colm_tree_hash( prg, tree2 ) )
+		return false;
+
+	return colm_cmp_tree( prg, tree1, tree2 ) == 0;
+}
 
 void split_ref( program_t *prg, tree_t ***psp, ref_t *from_ref )
 {
@@ -1350,7 +1796,9 @@ void split_ref( program_t *prg, tree_t ***psp, ref_t *from_ref )
 	}
 	ref->next = last;
 
-	/* Now traverse the list, which goes down. */
+	/* Now traverse the list, which goes down. Only the shared nodes on the
+	 * path are copied. */
+	int copied = false;
 	while ( ref != 0 ) {
 		if ( ref->kid->tree->refs > 1 ) {
 			ref_t *next_down = ref->next;
@@ -1363,10 +1811,12 @@ void split_ref( program_t *prg, tree_t ***psp, ref_t *from_ref )
 			tree_t *new_tree = colm_copy_tree( prg, ref->kid->tree, 
 					old_next_kid_down, &new_next_kid_down );
 			colm_tree_upref( prg, new_tree );
+			copied = true;
 			
 			/* Downref the original. Don't need to consider freeing because
 			 * refs were > 1. */
 			ref->kid->tree->refs -= 1;
+			new_tree->hash = 0;
 
 			while ( ref != 0 && ref != next_down ) {
 				next = ref->next;
@@ -1383,12 +1833,18 @@ void split_ref( program_t *prg, tree_t ***psp, ref_t *from_ref )
 			}
 		}
 		else {
+			/* Something below is about to change. */
+			ref->kid->tree->hash = 0;
+
 			/* Reset the list as we go down. */
 			next = ref->next;
 			ref->next = 0;
 			ref = next;
 		}
 	}
+
+	if ( copied )
+		prg->split_stats.splits += 1;
 }
 
 tree_t *set_list_mem( list_t *list, half_t field, tree_t *value )
@@ -1585,69 +2041,115 @@ tree_t *map_store( program_t *prg, map_t *map, tree_t *key, tree_t *element )
 }
 #endif
 
-static tree_t *tree_search_kid( program_t *prg, kid_t *kid, long id )
+/* Can a tree with the given id have a descendant with the search id, according
+ * to the grammar? Tokens have no children other than ignores and attributes.
+ * Ignores attach anywhere, so searches for them are never ruled out. */
+int tree_can_contain( program_t *prg, long id, long search_id )
 {
-	/* This node the one? */
-	if ( kid->tree->id == id )
-		return kid->tree;
+	struct colm_sections *rtd = prg->rtd;
 
-	tree_t *res = 0;
+	if ( search_id < 0 || search_id >= rtd->num_lang_els ||
+			search_id == LEL_ID_IGNORE || rtd->lel_info[search_id].ignore )
+		return true;
 
-	/* Search children. */
-	kid_t *child = tree_child( prg, kid->tree );
-	if ( child != 0 )
-		res = tree_search_kid( prg, child, id );
-	
-	/* Search siblings. */
-	if ( res == 0 && kid->next != 0 )
-		res = tree_search_kid( prg, kid->next, id );
+	if ( id < rtd->first_non_term_id )
+		return false;
+
+	if ( id >= rtd->num_lang_els || rtd->contain_sets == 0 )
+		return true;
 
-	return res;	
+	const unsigned char *row = rtd->contain_sets +
+			( id - rtd->first_non_term_id ) * rtd->contain_width;
+	return ( row[search_id >> 3] >> ( search_id & 7 ) ) & 1;
 }
 
 tree_t *tree_search( program_t *prg, tree_t *tree, long id )
 {
-	tree_t *res = 0;
 	if ( tree->id == id )
-		res = tree;
-	else {
-		kid_t *child = tree_child( prg, tree );
-		if ( child != 0 )
-			res = tree_search_kid( prg, child, id );
-	}
-	return res;
-}
+		return tree;
 
-static location_t *loc_search_kid( program_t *prg, kid_t *kid )
-{
-	/* This node the one? */
-	if ( kid->tree->tokdata != 0 && kid->tree->tokdata->location != 0 )
-		return kid->tree->tokdata->location;
+	if ( !tree_can_contain( prg, tree->id, id ) )
+		return 0;
 
-	location_t *res = 0;
+	struct kid_stack ks;
+	kid_stack_init( &ks );
 
-	/* Search children. */
-	kid_t *child = tree_child( prg, kid->tree );
-	if ( child != 0 )
-		res = loc_search_kid( prg, child );
-	
-	/* Search siblings. */
-	if ( res == 0 && kid->next != 0 )
-		res = loc_search_kid( prg, kid->next );
+	tree_t *res = 0;
+	kid_t *kid = tree_child( prg, tree );
+	while ( true ) {
+		if ( kid == 0 ) {
+			if ( ks.len == 0 )
+				break;
+			kid = kid_stack_pop( &ks );
+			continue;
+		}
 
-	return res;	
+		/* This node the one? */
+		if ( kid->tree->id == id ) {
+			res = kid->tree;
+			break;
+		}
+
+		/* Search children, then siblings. */
+		kid_t *child = tree_can_contain( prg, kid->tree->id, id ) ?
+				tree_child( prg, kid->tree ) : 0;
+		if ( child != 0 ) {
+			if ( kid->next != 0 )
+				kid_stack_push( &ks, kid->next );
+			kid = child;
+		}
+		else {
+			kid = kid->next;
+		}
+	}
+
+	kid_stack_destroy( &ks );
+	return res;
 }
 
-static location_t *loc_search( program_t *prg, tree_t *tree )
+static location_t *tree_location( tree_t *tree )
 {
-	location_t *res = 0;
 	if ( tree->tokdata != 0 && tree->tokdata->location != 0 )
 		return tree->tokdata->location;
+	return 0;
+}
 
-	kid_t *child = tree_child( prg, tree );
-	if ( child != 0 )
-		res = loc_search_kid( prg, child );
+static location_t *loc_search( program_t *prg, tree_t *tree )
+{
+	location_t *res = tree_location( tree );
+	if ( res != 0 )
+		return res;
 
+	struct kid_stack ks;
+	kid_stack_init( &ks );
+
+	kid_t *kid = tree_child( prg, tree );
+	while ( true ) {
+		if ( kid == 0 ) {
+			if ( ks.len == 0 )
+				break;
+			kid = kid_stack_pop( &ks );
+			continue;
+		}
+
+		/* This node the one? */
+		res = tree_location( kid->tree );
+		if ( res != 0 )
+			break;
+
+		/* Search children, then siblings. */
+		kid_t *child = tree_child( prg, kid->tree );
+		if ( child != 0 ) {
+			if ( kid->next != 0 )
+				kid_stack_push( &ks, kid->next );
+			kid = child;
+		}
+		else {
+			kid = kid->next;
+		}
+	}
+
+	kid_stack_destroy( &ks );
 	return res;
 }
 
@@ -1659,19 +2161,13 @@ struct colm_location *colm_find_location( program_t *prg, tree_t *tree )
 head_t *tree_to_str( program_t *prg, tree_t **sp, tree_t *tree, int trim, int attrs )
 {
 	/* Collect the tree data. */
-	str_collect_t collect;
-	init_str_collect( &collect );
+	str_collect_t *collect = colm_collect_borrow( prg );
 
 	if ( attrs )
-		colm_print_tree_collect_a( prg, sp, &collect, tree, trim );
+		colm_print_tree_collect_a( prg, sp, collect, tree, trim );
 	else
-		colm_print_tree_collect( prg, sp, &collect, tree, trim );
-
-	/* Set up the input stream. */
-	head_t *ret = string_alloc_full( prg, collect.data, collect.length );
-
-	str_collect_destroy( &collect );
+		colm_print_tree_collect( prg, sp, collect, tree, trim );
 
-	return ret;
+	return colm_collect_to_string( prg, collect );
 }
 
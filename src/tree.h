@@ -104,6 +104,9 @@ typedef struct colm_parse_tree
 	struct colm_parse_tree *right_ignore;
 	kid_t *shadow;
 
+	/* For shifted tokens, the token list entry that refers to the shadow. */
+	struct colm_ref *token_ref;
+
 	/* Parsing algorithm. */
 	long state;
 	short cause_reduce;
@@ -221,7 +224,10 @@ typedef struct colm_user_iter
 void colm_tree_upref_( tree_t *tree );
 void colm_tree_upref( struct colm_program *prg, tree_t *tree );
 void colm_tree_downref( struct colm_program *prg, tree_t **sp, tree_t *tree );
+void colm_unmap_snapshots( struct colm_program *prg );
+void colm_hash_cons_clear( struct colm_program *prg, tree_t **sp );
 long colm_cmp_tree( struct colm_program *prg, const tree_t *tree1, const tree_t *tree2 );
+int colm_equal_tree( struct colm_program *prg, tree_t *tree1, tree_t *tree2 );
 
 tree_t *push_right_ignore( struct colm_program *prg, tree_t *push_to, tree_t *right_ignore );
 tree_t *push_left_ignore( struct colm_program *prg, tree_t *push_to, tree_t *left_ignore );
@@ -273,6 +279,7 @@ void set_triter_cur( struct colm_program *prg, tree_iter_t *iter, tree_t *tree )
 void set_uiter_cur( struct colm_program *prg, user_iter_t *uiter, tree_t *tree );
 void ref_set_value( struct colm_program *prg, tree_t **sp, ref_t *ref, tree_t *v );
 tree_t *tree_search( struct colm_program *prg, tree_t *tree, long id );
+int tree_can_contain( struct colm_program *prg, long id, long search_id );
 
 int match_pattern( tree_t **bindings, struct colm_program *prg,
 		long pat, kid_t *kid, int check_next );
@@ -300,12 +307,14 @@ tree_t *tree_iter_next_repeat( struct colm_program *prg, tree_t ***psp, tree_ite
 tree_t *tree_iter_prev_repeat( struct colm_program *prg, tree_t ***psp, tree_iter_t *iter );
 
 /* An automatically grown buffer for collecting tokens. Always reuses space;
- * never down resizes. */
+ * never down resizes. A collector can reserve room for a string head in front
+ * of the data, so the storage can become a string without a copy. */
 typedef struct colm_str_collect
 {
 	char *data;
 	int allocated;
 	int length;
+	int reserve;
 	struct indent_impl indent;
 } str_collect_t;
 
@@ -313,6 +322,10 @@ void init_str_collect( str_collect_t *collect );
 void str_collect_destroy( str_collect_t *collect );
 void str_collect_append( str_collect_t *collect, const char *data, long len );
 void str_collect_clear( str_collect_t *collect );
+
+str_collect_t *colm_collect_borrow( struct colm_program *prg );
+void colm_collect_return( struct colm_program *prg, str_collect_t *collect );
+head_t *colm_collect_to_string( struct colm_program *prg, str_collect_t *collect );
 tree_t *tree_trim( struct colm_program *prg, tree_t **sp, tree_t *tree );
 
 void colm_print_tree_collect( struct colm_program *prg, tree_t **sp,
@@ -329,7 +342,7 @@ void colm_print_xml_stdout( struct colm_program *prg, tree_t **sp,
 void colm_postfix_tree_collect( struct colm_program *prg, tree_t **sp,
 		str_collect_t *collect, tree_t *tree, int trim );
 void colm_postfix_tree_file( struct colm_program *prg, tree_t **sp,
-		struct stream_impl *impl, tree_t *tree, int trim );
+		struct stream_impl_data *impl, tree_t *tree, int trim );
 
 /*
  * Iterators.
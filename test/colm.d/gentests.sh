@@ -36,6 +36,12 @@
 #
 # files containing C functions
 #
+###### LIB ######
+#
+# A second colm program, for tests with a host program. It is compiled with
+# the same compilation arguments as a library with object name lib_object and
+# linked into the host program.
+#
 
 #######################################
 
@@ -181,6 +187,7 @@ function runtests()
 		LM=$WORKING/$ROOT.lm
 		HOST=$WORKING/$ROOT.host.cc
 		CALL=$WORKING/$ROOT.call.c
+		LIB=$WORKING/$ROOT.lib.lm
 		SH=$WORKING/$ROOT.sh
 
 		section LM 0 $TST $LM
@@ -198,6 +205,7 @@ function runtests()
 
 		section CALL 0 $TST $CALL
 		section HOST 0 $TST $HOST
+		section LIB 0 $TST $LIB
 
 		COLM_ADDS=""
 		if test -f $CALL; then
@@ -218,8 +226,19 @@ function runtests()
 				continue
 			fi
 
-			echo gcc -c $COLM_CPPFLAGS $COLM_LDFLAGS -o $PARSE.o $PARSE.c >> $SH
-			echo g++ -I. $COLM_CPPFLAGS $COLM_LDFLAGS -o $WORKING/$ROOT $IF.cc $HOST $PARSE.o -lcolm >> $SH
+			# With split output there is more than one C file per program.
+			SRCS="$PARSE*.c"
+			OBJS="$PARSE*.o"
+			if test -f $LIB; then
+				LIBPARSE=$WORKING/$ROOT.lib.parse
+				echo $COLM_BIN $COMP -c -b lib_object -o $LIBPARSE.c $LIB >> $SH
+				SRCS="$SRCS $LIBPARSE*.c"
+				OBJS="$OBJS $LIBPARSE*.o"
+			fi
+
+			echo "for c in $SRCS; do" \
+				gcc -c $COLM_CPPFLAGS $COLM_LDFLAGS -o '${c%.c}.o $c; done' >> $SH
+			echo g++ -I. $COLM_CPPFLAGS $COLM_LDFLAGS -o $WORKING/$ROOT $IF.cc $HOST "$OBJS" -lcolm >> $SH
 
 			if ! check_compilation $?; then
 				continue